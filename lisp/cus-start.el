@@ -88,6 +88,9 @@ minibuffer-prompt-properties--setter
            `(;; alloc.c
 	     (gc-cons-threshold alloc integer)
 	     (gc-cons-percentage alloc float)
+	     (gc-idle-percentage alloc (choice (const :tag "Never" nil)
+					       float)
+				 "31.1")
 	     (garbage-collection-messages alloc boolean)
 	     ;; buffer.c
 	     (cursor-type display ,cursor-type-types)
@@ -96,7 +96,8 @@ bytecomp--log-lap-arg
                   (format "%S" (car tail))))) ; actual constant
        ;; Ops with an immediate argument.
        ((memq op '( stack-ref stack-set call unbind
-                    listN concatN insertN discardN discardN-preserve-tos))
+                    listN concatN insertN discardN discardN-preserve-tos
+                    stack-ref-car))
         (format "(%s %S)" op tail))
        ;; Without immediate, print just the symbol.
        (t op))))
@@ -2023,14 +2024,16 @@ disassemble-offset
                   (<= bytedecomp-op byte-goto-if-not-nil-else-pop))
              (memq bytedecomp-op (eval-when-compile
                                    (list byte-stack-set2 byte-pushcatch
-                                         byte-pushconditioncase))))
+                                         byte-pushconditioncase
+                                         byte-eq-goto-if-nil))))
 	 ;; Offset in next 2 bytes.
 	 (setq bytedecomp-ptr (1+ bytedecomp-ptr))
 	 (+ (aref bytes bytedecomp-ptr)
 	    (progn (setq bytedecomp-ptr (1+ bytedecomp-ptr))
 		   (ash (aref bytes bytedecomp-ptr) 8))))
-	((and (>= bytedecomp-op byte-listN)
-	      (<= bytedecomp-op byte-discardN))
+	((or (and (>= bytedecomp-op byte-listN)
+	          (<= bytedecomp-op byte-discardN))
+             (eq bytedecomp-op byte-stack-ref-car))
 	 (setq bytedecomp-ptr (1+ bytedecomp-ptr)) ;Offset in next byte.
 	 (aref bytes bytedecomp-ptr))))
 
@@ -2128,8 +2131,22 @@ byte-decompile-bytecode-1
                         ;; once.
                         do (setf (nth 2 el) last-constant) and return nil))))
       ;; lap = ( [ (pc . (op . arg)) ]* )
-      (push (cons optr (cons bytedecomp-op (or offset 0)))
-            lap)
+      (cond
+       ((not make-spliceable)
+        (push (cons optr (cons bytedecomp-op (or offset 0)))
+              lap))
+       ;; Code to be spliced into other code is optimized again, so
+       ;; split superinstructions back into the instructions they
+       ;; stand for, which the optimizer knows about.
+       ((eq bytedecomp-op 'byte-eq-goto-if-nil)
+        (push (cons optr (cons 'byte-eq 0)) lap)
+        (push (cons nil (cons 'byte-goto-if-nil offset)) lap))
+       ((eq bytedecomp-op 'byte-stack-ref-car)
+        (push (cons optr (cons 'byte-stack-ref offset)) lap)
+        (push (cons nil (cons 'byte-car 0)) lap))
+       (t
+        (push (cons optr (cons bytedecomp-op (or offset 0)))
+              lap)))
       (setq bytedecomp-ptr (1+ bytedecomp-ptr)))
     (let ((rest lap))
       (while rest
@@ -3110,6 +3127,34 @@ byte-optimize-lapcode
     (setq byte-compile-maxdepth (+ byte-compile-maxdepth add-depth))
     (cdr lap-head)))
 
+(defun byte-optimize-fuse-lapcode (lap)
+  "Replace common sequences of instructions in LAP with superinstructions.
+This is done after `byte-optimize-lapcode', whose transformations
+don't know about superinstructions, when `byte-compile-superinstructions'
+is non-nil.  The sequences were chosen from the pairs of instructions
+counted most often by `byte-code-meter'.  LAP is modified destructively
+and returned."
+  (let ((rest lap))
+    (while (cdr rest)
+      (let ((lap0 (car rest))
+            (lap1 (cadr rest)))
+        (cond
+         ;; eq goto-if-nil X  -->  eq-goto-if-nil X
+         ((and (eq (car lap0) 'byte-eq)
+               (eq (car lap1) 'byte-goto-if-nil))
+          (byte-compile-log-lap "  %s %s\t-->\teq-goto-if-nil" lap0 lap1)
+          (setcar rest (cons 'byte-eq-goto-if-nil (cdr lap1)))
+          (setcdr rest (cddr rest)))
+         ;; stack-ref N car  -->  stack-ref-car N
+         ((and (eq (car lap0) 'byte-stack-ref)
+               (< (cdr lap0) 256)
+               (eq (car lap1) 'byte-car))
+          (byte-compile-log-lap "  %s %s\t-->\tstack-ref-car" lap0 lap1)
+          (setcar rest (cons 'byte-stack-ref-car (cdr lap0)))
+          (setcdr rest (cddr rest)))))
+      (setq rest (cdr rest))))
+  lap)
+
 (provide 'byte-opt)
 
 
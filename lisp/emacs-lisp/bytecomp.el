@@ -209,6 +209,8 @@ byte-compile--default-dest-file
 (autoload 'byte-optimize-one-form "byte-opt")
 ;; This is the entry point to the lapcode optimizer pass2.
 (autoload 'byte-optimize-lapcode "byte-opt")
+;; This is the entry point to the superinstruction pass, run after pass2.
+(autoload 'byte-optimize-fuse-lapcode "byte-opt")
 
 ;; This is the entry point to the decompiler, which is used by the
 ;; disassembler.  The disassembler just requires 'byte-compile, but
@@ -233,6 +235,16 @@ byte-optimize
 		 (const :tag "source-level" source)
 		 (const :tag "byte-level" byte)))
 
+(defcustom byte-compile-superinstructions nil
+  "Non-nil means the byte compiler emits superinstructions.
+These are single instructions that do the work of common sequences of
+instructions, which makes the code run a little faster.  Code
+compiled this way can only be run by Emacs 31.1 or later, and it is
+never used when compiling to native code.  See also
+`byte-compile-report-ops'."
+  :type 'boolean
+  :version "31.1")
+
 (defcustom byte-compile-delete-errors nil
   "If non-nil, the optimizer may delete forms that may signal an error.
 This includes variable references and calls to functions such as `car'."
@@ -753,7 +765,14 @@ 48
 (byte-defop  49 -1 byte-pushconditioncase)
 (byte-defop  50 -1 byte-pushcatch)
 
-;; unused: 51-55
+;; Superinstructions, only emitted when `byte-compile-superinstructions'
+;; is non-nil.  See `byte-optimize-fuse-lapcode'.
+(byte-defop  51 -2 byte-eq-goto-if-nil
+  "to pop two values and jump if they are not `eq'")
+(byte-defop  52  1 byte-stack-ref-car
+  "for the car of a stack reference")
+
+;; unused: 53-55
 
 (byte-defop  56 -1 byte-nth)
 (byte-defop  57  0 byte-symbolp)
@@ -933,7 +952,8 @@ byte-constant-limit
 (defconst byte-goto-ops '(byte-goto byte-goto-if-nil byte-goto-if-not-nil
 			  byte-goto-if-nil-else-pop
 			  byte-goto-if-not-nil-else-pop
-                          byte-pushcatch byte-pushconditioncase)
+                          byte-pushcatch byte-pushconditioncase
+                          byte-eq-goto-if-nil)
   "List of byte-codes whose offset is a pc.")
 
 (defconst byte-goto-always-pop-ops '(byte-goto-if-nil byte-goto-if-not-nil))
@@ -1043,6 +1063,8 @@ byte-compile-lapcode
                     (< opcode byte-discardN))
                ;; These insns all put their operand into one extra byte.
                (byte-compile-push-bytecodes opcode off bytes pc))
+              ((= opcode byte-stack-ref-car)
+               (byte-compile-push-bytecodes opcode off bytes pc))
               ((= opcode byte-discardN)
                ;; byte-discardN is weird in that it encodes a flag in the
                ;; top bit of its one-byte argument.  If the argument is
@@ -3340,6 +3362,11 @@ byte-compile-out-toplevel
 	      (setq rest (cdr rest)))
 	    rest))
       (let ((byte-compile-vector (byte-compile-constants-vector)))
+	(when (and byte-compile-superinstructions
+		   (memq byte-optimize '(t byte))
+		   (not byte-native-compiling))
+	  (setq byte-compile-output
+		(byte-optimize-fuse-lapcode byte-compile-output)))
 	(list 'byte-code (byte-compile-lapcode byte-compile-output)
 	      byte-compile-vector byte-compile-maxdepth)))
      ;; it's a trivial function
@@ -5994,33 +6021,49 @@ bytecomp--check-keyword-args
 ;;; report metering (see the hacks in bytecode.c)
 
 (defvar byte-code-meter)
-(defun byte-compile-report-ops ()
-  (or (boundp 'byte-metering-on)
-      (error "You must build Emacs with -DBYTE_CODE_METER to use this"))
+
+(defun byte-compile--op-name (code)
+  "Return the name of byte opcode CODE, with its immediate operand if any."
+  (let ((op code) off)
+    (cond ((< op byte-pophandler)
+           (setq off (logand op 7))
+           (setq op (logand op 248)))
+          ((>= op byte-constant)
+           (setq off (- op byte-constant)
+                 op byte-constant)))
+    (concat (symbol-name (aref byte-code-vector op))
+            (if off (format " [%d]" off)))))
+
+(defun byte-compile-report-ops (&optional pairs)
+  "Display how many times each byte opcode was executed.
+The counts are those collected in `byte-code-meter' while
+`byte-metering-on' was non-nil.  With prefix argument PAIRS, display
+that many of the pairs of opcodes most often executed in succession,
+which are the candidates for superinstructions."
+  (interactive "P")
+  (unless (vectorp byte-code-meter)
+    (user-error "No byte code has been metered; set `byte-metering-on'"))
   (with-output-to-temp-buffer "*Meter*"
     (set-buffer "*Meter*")
-    (let ((i 0) n op off)
-      (while (< i 256)
-	(setq n (aref (aref byte-code-meter 0) i)
-	      off nil)
-	(if t				;(not (zerop n))
-	    (progn
-	      (setq op i)
-	      (setq off nil)
-	      (cond ((< op byte-nth)
-		     (setq off (logand op 7))
-		     (setq op (logand op 248)))
-		    ((>= op byte-constant)
-		     (setq off (- op byte-constant)
-			   op byte-constant)))
-	      (setq op (aref byte-code-vector op))
-	      (insert (format "%-4d" i))
-	      (insert (symbol-name op))
-	      (if off (insert " [" (int-to-string off) "]"))
-	      (indent-to 40)
-	      (insert (int-to-string n) "\n")))
-	(setq i (1+ i))))))
-
+    (dotimes (i 256)
+      (insert (format "%-4d" i) (byte-compile--op-name i))
+      (indent-to 40)
+      (insert (int-to-string (aref (aref byte-code-meter 0) i)) "\n"))
+    (when pairs
+      (let ((counts ()))
+        (dotimes (i 255)
+          (dotimes (j 256)
+            (let ((n (aref (aref byte-code-meter (1+ i)) j)))
+              (unless (zerop n)
+                (push (list n (1+ i) j) counts)))))
+        (setq counts (sort counts :key #'car :reverse t))
+        (insert "\nMost frequent pairs:\n")
+        (dolist (count (take (prefix-numeric-value pairs) counts))
+          (insert (byte-compile--op-name (nth 1 count)) ", "
+                  (byte-compile--op-name (nth 2 count)))
+          (indent-to 40)
+          (insert (int-to-string (car count)) "\n"))))))
+
 ;; To avoid "lisp nesting exceeds max-lisp-eval-depth" when bytecomp compiles
 ;; itself, compile some of its most used recursive functions (at load time).
 ;;
@@ -239,7 +239,8 @@ disassemble-1
 		((memq op '(byte-call byte-unbind
 			    byte-listN byte-concatN byte-insertN
 			    byte-stack-ref byte-stack-set byte-stack-set2
-			    byte-discardN byte-discardN-preserve-tos))
+			    byte-discardN byte-discardN-preserve-tos
+			    byte-stack-ref-car))
 		 (insert (int-to-string arg)))
 		((memq op '(byte-varref byte-varset byte-varbind))
 		 (prin1 (car arg) (current-buffer)))
@@ -49,6 +49,7 @@ memory-report
   (setq truncate-lines t)
   (message "Gathering data...")
   (let ((reports (append (memory-report--garbage-collect)
+                         (memory-report--string-data)
                          (memory-report--image-cache)
                          (memory-report--symbol-plist)
                          (memory-report--buffers)
@@ -136,6 +137,23 @@ memory-report--garbage-collect
                                 (capitalize (symbol-name (car object))))))
               (buffer-string))))))
 
+(defun memory-report--string-data ()
+  ;; This reports on the state after the garbage collection done by
+  ;; `memory-report--garbage-collect'.
+  (list
+   (with-temp-buffer
+     (insert (propertize "String Data\n\n" 'face 'bold))
+     (pcase-dolist (`(,class ,_blocks ,live ,free ,fragmented)
+                    (string-data-statistics))
+       (let ((name (capitalize (symbol-name class))))
+         (insert (format "%s  %s strings, live\n"
+                         (memory-report--format live) name)
+                 (format "%s  %s strings, free\n"
+                         (memory-report--format free) name)
+                 (format "%s  %s strings, fragmented\n"
+                         (memory-report--format fragmented) name))))
+     (buffer-string))))
+
 (defun memory-report--largest-variables ()
   (let ((variables nil))
     (mapatoms
@@ -0,0 +1,151 @@
+;;; QJ-b5.tit --- automatically generated (do not edit)   -*- lexical-binding: t -*-
+;; Generated by the `tit-dic-convert' function.
+
+;; This file is part of GNU Emacs.
+
+;; Quail package `chinese-qj-b5
+;;	Original TIT dictionary file: QJ-b5.tit
+
+;; # -*- coding: cn-big5 -*-
+;; # HANZI input table for cxterm
+;; # To be used by cxterm, convert me to .cit format first
+;; # .cit version 2
+;; ENCODE:	BIG5
+;; AUTOSELECT:	YES
+;; PROMPT:	漢字輸入::全角::
+;; #
+;; COMMENT Copyright 1991 by Yongguang Zhang.      (ygz@cs.purdue.edu)
+;; COMMENT Permission to use/modify/copy for any purpose is hereby granted.
+;; COMMENT Absolutely no warranties.
+;; # define keys
+;; VALIDINPUTKEY:	\040!"\043$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMN
+;; VALIDINPUTKEY:	OPQRSTUVWXYZ[\134]^_`abcdefghijklmnopqrstuvwxyz{|}~
+;; # the following line must not be removed
+;; BEGINDICTIONARY
+
+;;; End of the header of original TIT dictionary.
+
+;;; Code:
+
+(require 'quail)
+
+(quail-define-package "chinese-qj-b5" "Chinese-BIG5" "全B"
+ t
+"漢字輸入::全角::
+
+ Copyright 1991 by Yongguang Zhang.      (ygz@cs.purdue.edu)
+ Permission to use/modify/copy for any purpose is hereby granted.
+ Absolutely no warranties.
+"
+ '(("\C-?" . quail-delete-last-char)
+   
+   ("." . quail-next-translation)
+   (">" . quail-next-translation)
+   ("," . quail-prev-translation)
+   ("<" . quail-prev-translation))
+ nil nil nil nil)
+
+(quail-define-rules
+(" " "　")
+("!" "！")
+("\"" "〃")
+("#" "＃")
+("$" "﹩")
+("%" "％")
+("&" "＆")
+("'" "′")
+("(" "（")
+(")" "）")
+("*" "﹡")
+("+" "＋")
+("," "，")
+("-" "－")
+("." "．")
+("/" "／")
+("0" "０")
+("1" "１")
+("2" "２")
+("3" "３")
+("4" "４")
+("5" "５")
+("6" "６")
+("7" "７")
+("8" "８")
+("9" "９")
+(":" "：")
+(";" "；")
+("<" "〈")
+("=" "＝")
+(">" "〉")
+("?" "？")
+("@" "＠")
+("A" "Ａ")
+("B" "Ｂ")
+("C" "Ｃ")
+("D" "Ｄ")
+("E" "Ｅ")
+("F" "Ｆ")
+("G" "Ｇ")
+("H" "Ｈ")
+("I" "Ｉ")
+("J" "Ｊ")
+("K" "Ｋ")
+("L" "Ｌ")
+("M" "Ｍ")
+("N" "Ｎ")
+("O" "Ｏ")
+("P" "Ｐ")
+("Q" "Ｑ")
+("R" "Ｒ")
+("S" "Ｓ")
+("T" "Ｔ")
+("U" "Ｕ")
+("V" "Ｖ")
+("W" "Ｗ")
+("X" "Ｘ")
+("Y" "Ｙ")
+("Z" "Ｚ")
+("[" "【")
+("\\" "＼")
+("]" "】")
+("^" "︿")
+("_" "╴")
+("`" "‵")
+("a" "ａ")
+("b" "ｂ")
+("c" "ｃ")
+("d" "ｄ")
+("e" "ｅ")
+("f" "ｆ")
+("g" "ｇ")
+("h" "ｈ")
+("i" "ｉ")
+("j" "ｊ")
+("k" "ｋ")
+("l" "ｌ")
+("m" "ｍ")
+("n" "ｎ")
+("o" "ｏ")
+("p" "ｐ")
+("q" "ｑ")
+("r" "ｒ")
+("s" "ｓ")
+("t" "ｔ")
+("u" "ｕ")
+("v" "ｖ")
+("w" "ｗ")
+("x" "ｘ")
+("y" "ｙ")
+("z" "ｚ")
+("{" "｛")
+("|" "｜")
+("}" "｝")
+("~" "～")
+)
+
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; End:
+
+;;; QJ-b5.tit ends here
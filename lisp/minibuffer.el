@@ -250,6 +250,119 @@ completion-table-with-cache
                 (setq last-arg arg))))))
     (completion-table-dynamic new-fun)))
 
+(defun completion--index-key (elt)
+  "Return the string that ELT of an index stands for, or nil."
+  (let ((key (if (consp elt) (car elt) elt)))
+    (if (symbolp key) (symbol-name key) (and (stringp key) key))))
+
+(defun completion--index-compare (key prefix ignore-case)
+  "Compare the beginning of KEY with PREFIX.
+Return 0 if KEY starts with PREFIX, and a negative or positive
+number if it sorts before or after the strings that do."
+  (let ((res (compare-strings key 0 (min (length key) (length prefix))
+                              prefix nil nil ignore-case)))
+    (if (eq res t) 0 res)))
+
+(defun completion--index-bound (index prefix ignore-case upper)
+  "Return the first position in INDEX of a key that comes after PREFIX.
+If UPPER is nil, return the first position of a key that starts with
+PREFIX or comes after it."
+  (let ((lo 0)
+        (hi (length index)))
+    (while (< lo hi)
+      (let* ((mid (/ (+ lo hi) 2))
+             (res (completion--index-compare
+                   (completion--index-key (aref index mid))
+                   prefix ignore-case)))
+        (if (if upper (<= res 0) (< res 0))
+            (setq lo (1+ mid))
+          (setq hi mid))))
+    lo))
+
+(defun completion-table-with-index (collection)
+  "Create a completion table for COLLECTION that finds prefixes quickly.
+COLLECTION is a list, an alist, an obarray or a hash table, as
+accepted by `try-completion'.  Where `try-completion' tests every
+element of COLLECTION, the table returned by this function looks up
+the completions of a non-empty string with a binary search in a
+sorted index.  This can make completion much faster when COLLECTION
+is large and the table is used repeatedly, as by `completing-read'.
+
+The index is built when it is first needed, so changes to COLLECTION
+made after that are not seen by the table."
+  (let ((hash (hash-table-p collection))
+        elts index folded-index)
+    (lambda (string pred action)
+      (if (or (eq action 'metadata) (eq (car-safe action) 'boundaries))
+          (complete-with-action action collection string pred)
+        (unless elts
+          (cond
+           (hash
+            (maphash (lambda (k v)
+                       (when (completion--index-key k)
+                         (push (cons k v) elts)))
+                     collection))
+           ((or (obarrayp collection) (vectorp collection))
+            (mapatoms (lambda (s) (push s elts)) collection))
+           (t
+            (dolist (elt collection)
+              (when (completion--index-key elt)
+                (push elt elts)))))
+          (setq elts (nreverse elts)))
+        (complete-with-action
+         action
+         (if (equal string "")
+             elts
+           (let* ((ignore-case (and completion-ignore-case t))
+                  (index
+                   (or (if ignore-case folded-index index)
+                       (let ((new (sort (vconcat elts)
+                                        :key #'completion--index-key
+                                        :lessp
+                                        (lambda (a b)
+                                          (let ((res (compare-strings
+                                                      a nil nil b nil nil
+                                                      ignore-case)))
+                                            (and (integerp res)
+                                                 (< res 0)))))))
+                         (if ignore-case
+                             (setq folded-index new)
+                           (setq index new)))))
+                  (beg (completion--index-bound index string ignore-case nil))
+                  (i (completion--index-bound index string ignore-case t))
+                  candidates)
+             (while (> i beg)
+               (setq i (1- i))
+               (push (aref index i) candidates))
+             candidates))
+         string
+         (if (and pred hash)
+             (lambda (elt) (funcall pred (car elt) (cdr elt)))
+           pred))))))
+
+(defcustom completion-index-threshold nil
+  "Size of a completion collection above which `completing-read' indexes it.
+If this is an integer, `completing-read-default' passes lists and hash
+tables with more elements than this, and all obarrays, through
+`completion-table-with-index' before completing over them.
+If nil, collections are never indexed."
+  :type '(choice (const :tag "Never" nil)
+                 (natnum :tag "Number of elements"))
+  :version "31.1")
+
+(defun completion--maybe-index (collection)
+  "Return COLLECTION, indexed if `completion-index-threshold' says so."
+  (if (and completion-index-threshold
+           (cond
+            ((hash-table-p collection)
+             (> (hash-table-count collection) completion-index-threshold))
+            ((obarrayp collection) t)
+            ((consp collection)
+             (> (or (proper-list-p collection) 0)
+                completion-index-threshold))))
+      (completion-table-with-index collection)
+    collection))
+
 (defmacro lazy-completion-table (var fun)
   "Initialize variable VAR as a lazy completion table.
 If the completion table VAR is used for the first time (e.g., by passing VAR
@@ -4581,6 +4694,9 @@ completion-flex-nospace
   :version "27.1"
   :type 'boolean)
 
+(defvar completion-flex--query nil
+  "The characters that the `flex' style last matched, as a string.")
+
 (put 'flex 'completion--adjust-metadata 'completion--flex-adjust-metadata)
 
 (defun completion--flex-adjust-metadata (metadata)
@@ -4593,19 +4709,22 @@ completion--flex-adjust-metadata
     (cl-flet
         ((compose-flex-sort-fn (existing-sort-fn)
            (lambda (completions)
-             (let* ((sorted (sort
-                             (mapcar
-                              (lambda (str)
-                                (cons
-                                 (- (completion--flex-score
-                                     (or (get-text-property
-                                          0 'completion--unquoted str)
-                                         str)
-                                     completion-pcm--regexp))
-                                 str))
-                              (if existing-sort-fn
-                                  (funcall existing-sort-fn completions)
-                                completions))
+             (let* ((completions (if existing-sort-fn
+                                     (funcall existing-sort-fn completions)
+                                   completions))
+                    ;; Score all the completions in one go in C.
+                    (scores (completion-flex-match
+                             completion-flex--query
+                             (mapcar (lambda (str)
+                                       (or (get-text-property
+                                            0 'completion--unquoted str)
+                                           str))
+                                     completions)
+                             completion-ignore-case))
+                    (sorted (sort
+                             (cl-mapcar (lambda (score str)
+                                          (cons (- (or score 0)) str))
+                                        scores completions)
                              #'car-less-than-car))
                     (cell sorted))
                ;; Reuse the list
@@ -4662,6 +4781,9 @@ completion-flex-all-completions
                   string table pred point
                   #'completion-flex--make-flex-pattern)))
       (when all
+        (setq completion-flex--query
+              (mapconcat (lambda (elem) (if (stringp elem) elem ""))
+                         pattern))
         (nconc (completion-pcm--hilit-commonality pattern all)
                (length prefix))))))
 
@@ -4778,6 +4900,7 @@ completing-read-default
                    keymap))
          (buffer (current-buffer))
          (c-i-c completion-ignore-case)
+         (collection (completion--maybe-index collection))
          (result
           (minibuffer-with-setup-hook
               (lambda ()
@@ -360,6 +360,17 @@ #define HI_THRESHOLD (EMACS_INT_MAX / 2)
   object_ct total_intervals, total_free_intervals;
   object_ct total_buffers;
 
+  /* Number of sblocks holding the data of small strings, bytes of
+     them used by live strings, and bytes still available at the end
+     of the current one.  */
+  object_ct total_small_sblocks;
+  byte_ct total_small_sdata_bytes, total_free_small_sdata_bytes;
+
+  /* Number and total size of the sblocks holding the data of large
+     or immovable strings, and bytes of them used by the strings.  */
+  object_ct total_large_sblocks;
+  byte_ct total_large_sblock_bytes, total_large_sdata_bytes;
+
   /* Size of the ancillary arrays of live hash-table and obarray objects.
      The objects themselves are not included (counted as vectors above).  */
   byte_ct total_hash_table_bytes;
@@ -2204,6 +2215,9 @@ free_large_strings (void)
   struct sblock *b, *next;
   struct sblock *live_blocks = NULL;
 
+  gcstat.total_large_sblocks = 0;
+  gcstat.total_large_sblock_bytes = gcstat.total_large_sdata_bytes = 0;
+
   for (b = large_sblocks; b; b = next)
     {
       next = b->next;
@@ -2212,6 +2226,11 @@ free_large_strings (void)
 	lisp_free (b);
       else
 	{
+	  ptrdiff_t needed = sdata_size (STRING_BYTES (b->data[0].string));
+	  gcstat.total_large_sblocks++;
+	  gcstat.total_large_sblock_bytes
+	    += FLEXSIZEOF (struct sblock, data, needed) + GC_STRING_EXTRA;
+	  gcstat.total_large_sdata_bytes += needed + GC_STRING_EXTRA;
 	  b->next = live_blocks;
 	  live_blocks = b;
 	}
@@ -2230,6 +2249,8 @@ compact_small_strings (void)
   /* TB is the sblock we copy to, TO is the sdata within TB we copy
      to, and TB_END is the end of TB.  */
   struct sblock *tb = oldest_sblock;
+  gcstat.total_small_sblocks = 0;
+  gcstat.total_small_sdata_bytes = gcstat.total_free_small_sdata_bytes = 0;
   if (tb)
     {
       sdata *tb_end = (sdata *) ((char *) tb + SBLOCK_SIZE);
@@ -2298,6 +2319,7 @@ compact_small_strings (void)
 
 		  /* Advance past the sdata we copied to.  */
 		  to = to_end;
+		  gcstat.total_small_sdata_bytes += size + GC_STRING_EXTRA;
 		}
 	      from = from_end;
 	    }
@@ -2316,6 +2338,10 @@ compact_small_strings (void)
 
       tb->next_free = to;
       tb->next = NULL;
+
+      for (b = oldest_sblock; b; b = b->next)
+	gcstat.total_small_sblocks++;
+      gcstat.total_free_small_sdata_bytes = (char *) tb_end - (char *) to;
     }
 
   current_sblock = tb;
@@ -2682,10 +2708,6 @@ #define SETMARKBIT(block,n)				\
   ((block)->gcmarkbits[(n) / BITS_PER_BITS_WORD]	\
    |= (bits_word) 1 << ((n) % BITS_PER_BITS_WORD))
 
-#define UNSETMARKBIT(block,n)				\
-  ((block)->gcmarkbits[(n) / BITS_PER_BITS_WORD]	\
-   &= ~((bits_word) 1 << ((n) % BITS_PER_BITS_WORD)))
-
 #define FLOAT_BLOCK(fptr) \
   (eassert (!pdumper_object_p (fptr)),                                  \
    ((struct float_block *) (((uintptr_t) (fptr)) & ~(BLOCK_ALIGN - 1))))
@@ -2707,9 +2729,6 @@ #define XFLOAT_MARKED_P(fptr) \
 #define XFLOAT_MARK(fptr) \
   SETMARKBIT (FLOAT_BLOCK (fptr), FLOAT_INDEX (fptr))
 
-#define XFLOAT_UNMARK(fptr) \
-  UNSETMARKBIT (FLOAT_BLOCK (fptr), FLOAT_INDEX (fptr))
-
 #if GC_ASAN_POISON_OBJECTS
 # define ASAN_POISON_FLOAT_BLOCK(fblk)         \
   __asan_poison_memory_region ((fblk)->floats, \
@@ -2819,9 +2838,6 @@ #define XCONS_MARKED_P(fptr) \
 #define XMARK_CONS(fptr) \
   SETMARKBIT (CONS_BLOCK (fptr), CONS_INDEX (fptr))
 
-#define XUNMARK_CONS(fptr) \
-  UNSETMARKBIT (CONS_BLOCK (fptr), CONS_INDEX (fptr))
-
 /* Minimum number of bytes of consing since GC before next GC,
    when memory is full.  */
 
@@ -2981,21 +2997,59 @@ pure_listn (ptrdiff_t count, Lisp_Object arg1, ...)
   return val;
 }
 
+/* Return a list of the NELTS objects in ELTS, or of NELTS copies of
+   INIT if ELTS is null, followed by TAIL.  Rather than taking the
+   conses one at a time like Fcons, carve them out of the unused part
+   of the current cons block several at a time, so that the cells of a
+   list built in one go, like the result of `mapcar', are contiguous
+   and in order as far as possible.  */
+
+static Lisp_Object
+bulk_list (ptrdiff_t nelts, Lisp_Object const *elts, Lisp_Object init,
+	   Lisp_Object tail)
+{
+  Lisp_Object val = tail;
+
+  while (0 < nelts)
+    {
+      if (cons_block_index == CONS_BLOCK_SIZE)
+	{
+	  /* The current block is full.  Let Fcons take a cell from the
+	     free list, or start a new block.  */
+	  nelts--;
+	  val = Fcons (elts ? elts[nelts] : init, val);
+	  continue;
+	}
+
+      MALLOC_BLOCK_INPUT;
+      int n = min (nelts, CONS_BLOCK_SIZE - cons_block_index);
+      struct Lisp_Cons *c = &cons_block->conses[cons_block_index];
+      cons_block_index += n;
+      MALLOC_UNBLOCK_INPUT;
+
+      nelts -= n;
+      for (int i = n - 1; 0 <= i; i--)
+	{
+	  ASAN_UNPOISON_CONS (&c[i]);
+	  c[i].u.s.car = elts ? elts[nelts + i] : init;
+	  c[i].u.s.u.cdr = val;
+	  XSETCONS (val, &c[i]);
+	  eassert (!XCONS_MARKED_P (XCONS (val)));
+	}
+      consing_until_gc -= n * sizeof (struct Lisp_Cons);
+      cons_cells_consed += n;
+    }
+
+  return val;
+}
+
 DEFUN ("list", Flist, Slist, 0, MANY, 0,
        doc: /* Return a newly created list with specified arguments as elements.
 Allows any number of arguments, including zero.
 usage: (list &rest OBJECTS)  */)
   (ptrdiff_t nargs, Lisp_Object *args)
 {
-  register Lisp_Object val;
-  val = Qnil;
-
-  while (nargs > 0)
-    {
-      nargs--;
-      val = Fcons (args[nargs], val);
-    }
-  return val;
+  return bulk_list (nargs, args, Qnil, Qnil);
 }
 
 
@@ -3006,10 +3060,13 @@ DEFUN ("make-list", Fmake_list, Smake_list, 2, 2, 0,
   Lisp_Object val = Qnil;
   CHECK_FIXNAT (length);
 
-  for (EMACS_INT size = XFIXNAT (length); 0 < size; size--)
+  for (EMACS_INT size = XFIXNAT (length); 0 < size; )
     {
-      val = Fcons (init, val);
-      rarely_quit (size);
+      ptrdiff_t n = min (size, USHRT_MAX);
+      val = bulk_list (n, NULL, init, val);
+      size -= n;
+      if (0 < size)
+	maybe_quit ();
     }
 
   return val;
@@ -6518,6 +6575,23 @@ maybe_garbage_collect (void)
     garbage_collect ();
 }
 
+/* Emacs is idle, waiting for input.  If at least the portion
+   gc-idle-percentage of the consing allowed between collections has
+   been used up, collect garbage now, so that the collection does not
+   interrupt the next command instead.  Otherwise collect garbage only
+   if it is due anyway.  */
+void
+maybe_garbage_collect_when_idle (void)
+{
+  if (FLOATP (Vgc_idle_percentage)
+      && 0 < XFLOAT_DATA (Vgc_idle_percentage)
+      && (XFLOAT_DATA (Vgc_idle_percentage) * gc_threshold
+	  <= gc_threshold - consing_until_gc))
+    garbage_collect ();
+  else
+    maybe_gc ();
+}
+
 static inline bool mark_stack_empty_p (void);
 
 /* Subroutine of Fgarbage_collect that does most of the work.  */
@@ -6717,9 +6791,13 @@ garbage_collect (void)
   if (FLOATP (Vgc_elapsed))
     {
       static struct timespec gc_elapsed;
-      gc_elapsed = timespec_add (gc_elapsed,
-				 timespec_sub (current_timespec (), start));
+      struct timespec pause = timespec_sub (current_timespec (), start);
+      gc_elapsed = timespec_add (gc_elapsed, pause);
       Vgc_elapsed = make_float (timespectod (gc_elapsed));
+      Vgc_last_elapsed = make_float (timespectod (pause));
+      if (! (FLOATP (Vgc_max_elapsed)
+	     && XFLOAT_DATA (Vgc_last_elapsed) <= XFLOAT_DATA (Vgc_max_elapsed)))
+	Vgc_max_elapsed = Vgc_last_elapsed;
     }
 
   gcs_done++;
@@ -7578,33 +7656,30 @@ sweep_conses (void)
           else
             {
               /* Some cons cells for this int are not marked.
-                 Find which ones, and free them.  */
-              int start, pos, stop;
-
-              start = i * BITS_PER_BITS_WORD;
-              stop = lim - start;
-              if (stop > BITS_PER_BITS_WORD)
-                stop = BITS_PER_BITS_WORD;
-              stop += start;
-
-              for (pos = start; pos < stop; pos++)
+                 Find which ones, and free them.  Test the mark bits
+                 in a local copy of the word, and clear them all at
+                 once afterwards, rather than computing the block and
+                 index of every cell anew.  */
+              bits_word bits = cblk->gcmarkbits[i];
+              int start = i * BITS_PER_BITS_WORD;
+              int stop = min (lim - start, BITS_PER_BITS_WORD);
+
+              for (int j = 0; j < stop; j++)
                 {
-		  struct Lisp_Cons *acons = &cblk->conses[pos];
-		  if (!XCONS_MARKED_P (acons))
+                  if (bits & ((bits_word) 1 << j))
+                    num_used++;
+                  else
                     {
-		      ASAN_UNPOISON_CONS (&cblk->conses[pos]);
+                      struct Lisp_Cons *acons = &cblk->conses[start + j];
+		      ASAN_UNPOISON_CONS (acons);
                       this_free++;
-                      cblk->conses[pos].u.s.u.chain = cons_free_list;
-                      cons_free_list = &cblk->conses[pos];
+                      acons->u.s.u.chain = cons_free_list;
+                      cons_free_list = acons;
                       cons_free_list->u.s.car = dead_object ();
-		      ASAN_POISON_CONS (&cblk->conses[pos]);
+		      ASAN_POISON_CONS (acons);
 		    }
-                  else
-                    {
-                      num_used++;
-		      XUNMARK_CONS (acons);
-                    }
                 }
+              cblk->gcmarkbits[i] = 0;
             }
         }
 
@@ -7643,22 +7718,38 @@ sweep_floats (void)
   for (struct float_block *fblk; (fblk = *fprev); )
     {
       int this_free = 0;
+      int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
       ASAN_UNPOISON_FLOAT_BLOCK (fblk);
-      for (int i = 0; i < lim; i++)
+
+      /* Scan the mark bits a word at a time, as in sweep_conses.  */
+      for (int i = 0; i < ilim; i++)
 	{
-	  struct Lisp_Float *afloat = &fblk->floats[i];
-	  if (!XFLOAT_MARKED_P (afloat))
+	  bits_word bits = fblk->gcmarkbits[i];
+	  if (bits == BITS_WORD_MAX)
 	    {
-	      this_free++;
-	      fblk->floats[i].u.chain = float_free_list;
-	      ASAN_POISON_FLOAT (&fblk->floats[i]);
-	      float_free_list = &fblk->floats[i];
+	      /* Fast path - all floats for this word are marked.  */
+	      num_used += BITS_PER_BITS_WORD;
 	    }
 	  else
 	    {
-	      num_used++;
-	      XFLOAT_UNMARK (afloat);
+	      int start = i * BITS_PER_BITS_WORD;
+	      int stop = min (lim - start, BITS_PER_BITS_WORD);
+
+	      for (int j = 0; j < stop; j++)
+		{
+		  if (bits & ((bits_word) 1 << j))
+		    num_used++;
+		  else
+		    {
+		      struct Lisp_Float *afloat = &fblk->floats[start + j];
+		      this_free++;
+		      afloat->u.chain = float_free_list;
+		      ASAN_POISON_FLOAT (afloat);
+		      float_free_list = afloat;
+		    }
+		}
 	    }
+	  fblk->gcmarkbits[i] = 0;
 	}
       lim = FLOAT_BLOCK_SIZE;
       /* If this block contains only free floats and we have already
@@ -7937,6 +8028,44 @@ DEFUN ("memory-use-counts", Fmemory_use_counts, Smemory_use_counts, 0, 0, 0,
 		make_int (strings_consed));
 }
 
+DEFUN ("string-data-statistics", Fstring_data_statistics,
+       Sstring_data_statistics, 0, 0, 0,
+       doc: /* Return statistics about the memory holding the contents of strings.
+The statistics are those computed by the most recent garbage collection.
+The value is a list of entries of the form
+
+  (CLASS BLOCKS LIVE FREE FRAGMENTED)
+
+where:
+- CLASS is `small' for the data of small strings, which is allocated
+  from blocks shared by many strings and compacted by garbage
+  collection, or `large' for the data of large strings, each of which
+  has a block of its own,
+- BLOCKS is the number of blocks of that class,
+- LIVE is the number of bytes in those blocks used by live strings,
+- FREE is the number of bytes in those blocks that are available for
+  new strings,
+- FRAGMENTED is the number of the remaining bytes in those blocks,
+  which are lost to block headers and to space at the end of blocks
+  too small for the next string.  */)
+  (void)
+{
+  struct gcstat gcst = gcstat;
+  byte_ct small_bytes = gcst.total_small_sblocks * SBLOCK_SIZE;
+
+  return list2 (list5 (Qsmall, make_int (gcst.total_small_sblocks),
+		       make_uint (gcst.total_small_sdata_bytes),
+		       make_uint (gcst.total_free_small_sdata_bytes),
+		       make_uint (small_bytes
+				  - gcst.total_small_sdata_bytes
+				  - gcst.total_free_small_sdata_bytes)),
+		list5 (Qlarge, make_int (gcst.total_large_sblocks),
+		       make_uint (gcst.total_large_sdata_bytes),
+		       make_fixnum (0),
+		       make_uint (gcst.total_large_sblock_bytes
+				  - gcst.total_large_sdata_bytes)));
+}
+
 #if defined GNU_LINUX && defined __GLIBC__ && \
   (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 10)
 DEFUN ("malloc-info", Fmalloc_info, Smalloc_info, 0, 0, "",
@@ -8132,6 +8261,8 @@ init_alloc_once_for_pdumper (void)
 init_alloc (void)
 {
   Vgc_elapsed = make_float (0.0);
+  Vgc_last_elapsed = make_float (0.0);
+  Vgc_max_elapsed = make_float (0.0);
   gcs_done = 0;
 }
 
@@ -8166,6 +8297,20 @@ syms_of_alloc (void)
 If this portion is smaller than `gc-cons-threshold', this is ignored.  */);
   Vgc_cons_percentage = make_float (0.1);
 
+  DEFVAR_LISP ("gc-idle-percentage", Vgc_idle_percentage,
+	       doc: /* Portion of the GC threshold after which to collect garbage when idle.
+If this is a positive floating-point number, and Emacs is waiting for
+input after at least this portion of the consing allowed between
+garbage collections (see `gc-cons-threshold' and `gc-cons-percentage')
+has been done, Emacs collects garbage right away, instead of waiting
+for the threshold to be exhausted, which is likely to happen while
+the next command is executing.
+
+This makes pauses due to garbage collection less likely to be
+noticeable, at the price of collecting garbage more often.  A value
+of nil means never collect garbage early.  */);
+  Vgc_idle_percentage = Qnil;
+
   DEFVAR_INT ("pure-bytes-used", pure_bytes_used,
 	      doc: /* Number of bytes of shareable Lisp data allocated so far.  */);
 
@@ -8230,6 +8375,8 @@ syms_of_alloc (void)
   DEFSYM (Qintervals, "intervals");
   DEFSYM (Qbuffers, "buffers");
   DEFSYM (Qstring_bytes, "string-bytes");
+  DEFSYM (Qsmall, "small");
+  DEFSYM (Qlarge, "large");
   DEFSYM (Qvector_slots, "vector-slots");
   DEFSYM (Qheap, "heap");
   DEFSYM (QAutomatic_GC, "Automatic GC");
@@ -8241,6 +8388,13 @@ syms_of_alloc (void)
   DEFVAR_LISP ("gc-elapsed", Vgc_elapsed,
 	       doc: /* Accumulated time elapsed in garbage collections.
 The time is in seconds as a floating point value.  */);
+  DEFVAR_LISP ("gc-last-elapsed", Vgc_last_elapsed,
+	       doc: /* Time elapsed in the most recent garbage collection.
+The time is in seconds as a floating point value.  */);
+  DEFVAR_LISP ("gc-max-elapsed", Vgc_max_elapsed,
+	       doc: /* Longest time elapsed in a single garbage collection.
+The time is in seconds as a floating point value.  Set this to 0.0 to
+start measuring anew.  */);
   DEFVAR_INT ("gcs-done", gcs_done,
               doc: /* Accumulated number of garbage collections done.  */);
 
@@ -8269,6 +8423,7 @@ syms_of_alloc (void)
   defsubr (&Sgarbage_collect_maybe);
   defsubr (&Smemory_info);
   defsubr (&Smemory_use_counts);
+  defsubr (&Sstring_data_statistics);
 #if defined GNU_LINUX && defined __GLIBC__ && \
   (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 10)
 
@@ -561,6 +561,40 @@ run_buffer_list_update_hook (struct buffer *buf)
     call1 (Vrun_hooks, Qbuffer_list_update_hook);
 }
 
+/* Remove ELT from Vbuffer_alist.  Since Lisp can't see Vbuffer_alist,
+   this uses XSETCDR rather than Fdelq, whose Fsetcdr would needlessly
+   flush the keymap caches.  */
+
+static void
+buffer_alist_remove (Lisp_Object elt)
+{
+  Lisp_Object prev = Qnil;
+  for (Lisp_Object tail = Vbuffer_alist; CONSP (tail); tail = XCDR (tail))
+    if (!EQ (XCAR (tail), elt))
+      prev = tail;
+    else if (NILP (prev))
+      Vbuffer_alist = XCDR (tail);
+    else
+      XSETCDR (prev, XCDR (tail));
+}
+
+/* Add the list CELLS at the end of Vbuffer_alist, like nconc2 but
+   without flushing the keymap caches; see buffer_alist_remove.  */
+
+static void
+buffer_alist_append (Lisp_Object cells)
+{
+  if (NILP (Vbuffer_alist))
+    Vbuffer_alist = cells;
+  else
+    {
+      Lisp_Object tail = Vbuffer_alist;
+      while (CONSP (XCDR (tail)))
+	tail = XCDR (tail);
+      XSETCDR (tail, cells);
+    }
+}
+
 DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 2, 0,
        doc: /* Return the buffer specified by BUFFER-OR-NAME, creating a new one if needed.
 If BUFFER-OR-NAME is a string and a live buffer with that name exists,
@@ -638,6 +672,7 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 2, 0,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->line_index = 0;
   bset_width_table (b, Qnil);
   b->prevent_redisplay_optimizations_p = 1;
 
@@ -663,7 +698,7 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 2, 0,
 
   /* Put this in the alist of all live buffers.  */
   XSETBUFFER (buffer, b);
-  Vbuffer_alist = nconc2 (Vbuffer_alist, list1 (Fcons (name, buffer)));
+  buffer_alist_append (list1 (Fcons (name, buffer)));
 
   run_buffer_list_update_hook (b);
 
@@ -865,6 +900,7 @@ DEFUN ("make-indirect-buffer", Fmake_indirect_buffer, Smake_indirect_buffer,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->line_index = 0;
   bset_width_table (b, Qnil);
 
   name = Fcopy_sequence (name);
@@ -880,7 +916,7 @@ DEFUN ("make-indirect-buffer", Fmake_indirect_buffer, Smake_indirect_buffer,
 
   /* Put this in the alist of all live buffers.  */
   XSETBUFFER (buf, b);
-  Vbuffer_alist = nconc2 (Vbuffer_alist, list1 (Fcons (name, buf)));
+  buffer_alist_append (list1 (Fcons (name, buf)));
 
   bset_mark (b, Fmake_marker ());
 
@@ -2063,7 +2099,7 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
      not traced by the GC in the same way.  So set it to nil early.  */
   bset_undo_list (b, Qnil);
   /* Remove the buffer from the list of all buffers.  */
-  Vbuffer_alist = Fdelq (Frassq (buffer, Vbuffer_alist), Vbuffer_alist);
+  buffer_alist_remove (Frassq (buffer, Vbuffer_alist));
   /* If replace_buffer_in_windows didn't do its job fix that now.  */
   replace_buffer_in_windows_safely (buffer);
   Vinhibit_quit = tem;
@@ -2145,6 +2181,11 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
       free_region_cache (b->newline_cache);
       b->newline_cache = 0;
     }
+  if (b->line_index)
+    {
+      free_line_index (b->line_index);
+      b->line_index = 0;
+    }
   if (b->width_run_cache)
     {
       free_region_cache (b->width_run_cache);
@@ -2189,7 +2230,7 @@ record_buffer (Lisp_Object buffer)
   Vinhibit_quit = Qt;
   aelt = Frassq (buffer, Vbuffer_alist);
   aelt_cons = Fmemq (aelt, Vbuffer_alist);
-  Vbuffer_alist = Fdelq (aelt, Vbuffer_alist);
+  buffer_alist_remove (aelt);
   XSETCDR (aelt_cons, Vbuffer_alist);
   Vbuffer_alist = aelt_cons;
   Vinhibit_quit = tem;
@@ -2225,9 +2266,9 @@ DEFUN ("bury-buffer-internal", Fbury_buffer_internal, Sbury_buffer_internal,
   Vinhibit_quit = Qt;
   aelt = Frassq (buffer, Vbuffer_alist);
   aelt_cons = Fmemq (aelt, Vbuffer_alist);
-  Vbuffer_alist = Fdelq (aelt, Vbuffer_alist);
+  buffer_alist_remove (aelt);
   XSETCDR (aelt_cons, Qnil);
-  Vbuffer_alist = nconc2 (Vbuffer_alist, aelt_cons);
+  buffer_alist_append (aelt_cons);
   Vinhibit_quit = tem;
 
   /* Update buffer lists of selected frame.  */
@@ -2598,6 +2639,7 @@ #define swapfield_(field, type) \
   swapfield (newline_cache, struct region_cache *);
   swapfield (width_run_cache, struct region_cache *);
   swapfield (bidi_paragraph_cache, struct region_cache *);
+  swapfield (line_index, struct line_index *);
   current_buffer->prevent_redisplay_optimizations_p = 1;
   other_buffer->prevent_redisplay_optimizations_p = 1;
   swapfield (long_line_optimizations_p, bool_bf);
@@ -5782,6 +5824,11 @@ from (abs POSITION).  If POSITION is positive, point was at the front
 results of these scans are cached.  This doesn't help too much if
 paragraphs are of the reasonable (few thousands of characters) size.
 
+Counting lines, as `line-number-at-pos' and the display of line
+numbers do, also scans the buffer.  If `cache-long-scans' is non-nil,
+Emacs records the number of newlines in successive chunks of large
+buffers, so that it need not rescan the whole buffer to count lines.
+
 The caches require no explicit maintenance; their accuracy is
 maintained internally by the Emacs primitives.  Enabling or disabling
 the cache should not affect the behavior of any of the motion
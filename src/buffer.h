@@ -679,6 +679,12 @@ #define BVAR(buf, field) ((buf)->field ## _)
   struct region_cache *width_run_cache;
   struct region_cache *bidi_paragraph_cache;
 
+  /* If cache-long-scans is non-nil, the line index records how many
+     newlines there are in successive chunks of the text, to count
+     lines in large buffers quickly; see search.c.  It is made the
+     first time many lines are counted.  */
+  struct line_index *line_index;
+
   /* Non-zero means disable redisplay optimizations when rebuilding the glyph
      matrices (but not when redrawing).  */
   bool_bf prevent_redisplay_optimizations_p : 1;
@@ -36,42 +36,48 @@
 # define BYTE_CODE_SAFE false
 #endif
 
-/* Define BYTE_CODE_METER to generate a byte-op usage histogram.  */
-/* #define BYTE_CODE_METER */
-
 /* If BYTE_CODE_THREADED is defined, then the interpreter will be
    indirect threaded, using GCC's computed goto extension.  This code,
-   as currently implemented, is incompatible with BYTE_CODE_SAFE and
-   BYTE_CODE_METER.  */
-#if (defined __GNUC__ && !defined __STRICT_ANSI__ \
-     && !BYTE_CODE_SAFE && !defined BYTE_CODE_METER)
+   as currently implemented, is incompatible with BYTE_CODE_SAFE.  */
+#if (defined __GNUC__ && !defined __STRICT_ANSI__ && !BYTE_CODE_SAFE)
 #define BYTE_CODE_THREADED
 #endif
 
-
-#ifdef BYTE_CODE_METER
-
-#define METER_2(code1, code2) \
-  (*aref_addr (AREF (Vbyte_code_meter, code1), code2))
-#define METER_1(code) METER_2 (0, code)
-
-#define METER_CODE(last_code, this_code)				\
-{									\
-  if (byte_metering_on)							\
-    {									\
-      if (XFIXNAT (METER_1 (this_code)) < MOST_POSITIVE_FIXNUM)	\
-        XSETFASTINT (METER_1 (this_code),				\
-		     XFIXNAT (METER_1 (this_code)) + 1);		\
-      if (last_code							\
-	  && (XFIXNAT (METER_2 (last_code, this_code))			\
-	      < MOST_POSITIVE_FIXNUM))					\
-        XSETFASTINT (METER_2 (last_code, this_code),			\
-		     XFIXNAT (METER_2 (last_code, this_code)) + 1);	\
-    }									\
+/* The op executed before the one being metered, or 0.  */
+static int byte_meter_last_op;
+
+/* Increment element OP of COUNTS, a row of byte-code-meter.  */
+
+static void
+meter_count (Lisp_Object counts, int op)
+{
+  if (VECTORP (counts) && ASIZE (counts) == 256)
+    {
+      Lisp_Object n = AREF (counts, op);
+      if (FIXNATP (n) && XFIXNAT (n) < MOST_POSITIVE_FIXNUM)
+	ASET (counts, op, make_fixnum (XFIXNAT (n) + 1));
+    }
+}
+
+/* Count an execution of byte op OP in byte-code-meter, along with the
+   pair it forms with the op executed before it.  Called for every op
+   while byte-metering-on is non-nil.  */
+
+static void
+meter_byte_op (int op)
+{
+  if (! (VECTORP (Vbyte_code_meter) && ASIZE (Vbyte_code_meter) == 256))
+    {
+      Vbyte_code_meter = make_nil_vector (256);
+      for (int i = 0; i < 256; i++)
+	ASET (Vbyte_code_meter, i, make_vector (256, make_fixnum (0)));
+    }
+  meter_count (AREF (Vbyte_code_meter, 0), op);
+  if (byte_meter_last_op)
+    meter_count (AREF (Vbyte_code_meter, byte_meter_last_op), op);
+  byte_meter_last_op = op;
 }
 
-#endif /* BYTE_CODE_METER */
-
 
 /*  Byte codes: */
 
@@ -128,6 +134,10 @@ DEFINE (Bunbind7, 057)							\
 DEFINE (Bpophandler, 060)						\
 DEFINE (Bpushconditioncase, 061)					\
 DEFINE (Bpushcatch, 062)						\
+/* Superinstructions, only emitted when `byte-compile-superinstructions'	\
+   is non-nil.  */							\
+DEFINE (Beq_gotoifnil, 063)						\
+DEFINE (Bstack_ref_car, 064)						\
 									\
 DEFINE (Bnth, 070)							\
 DEFINE (Bsymbolp, 071)							\
@@ -464,9 +474,6 @@ valid_sp (struct bc_thread_state *bc, Lisp_Object *sp)
 exec_byte_code (Lisp_Object fun, ptrdiff_t args_template,
 		ptrdiff_t nargs, Lisp_Object *args)
 {
-#ifdef BYTE_CODE_METER
-  int volatile this_op = 0;
-#endif
   unsigned char quitcounter = 1;
   struct bc_thread_state *bc = &current_thread->bc;
 
@@ -535,6 +542,15 @@ exec_byte_code (Lisp_Object fun, ptrdiff_t args_template,
 #if GCC_LINT && __GNUC__ && !__clang__
   Lisp_Object *volatile saved_vectorp;
   unsigned char const *volatile saved_bytestr_data;
+# ifdef BYTE_CODE_THREADED
+  void const *const *volatile saved_dispatch;
+# endif
+#endif
+#ifdef BYTE_CODE_THREADED
+  /* The dispatch table in use, either TARGETS or METER_TARGETS below.
+     It is chosen on entry to each function, so setting
+     byte-metering-on takes effect at the next call.  */
+  void const *const *dispatch;
 #endif
 
   while (true)
@@ -545,12 +561,10 @@ exec_byte_code (Lisp_Object fun, ptrdiff_t args_template,
       if (BYTE_CODE_SAFE && !valid_sp (bc, top))
 	emacs_abort ();
 
-#ifdef BYTE_CODE_METER
-      int prev_op = this_op;
-      this_op = op = FETCH;
-      METER_CODE (prev_op, op);
-#elif !defined BYTE_CODE_THREADED
+#ifndef BYTE_CODE_THREADED
       op = FETCH;
+      if (byte_metering_on)
+	meter_byte_op (op);
 #endif
 
       /* The interpreter can be compiled one of two ways: as an
@@ -566,7 +580,7 @@ #define CASE(OP) insn_ ## OP
       /* NEXT is invoked at the end of an instruction to go to the
 	 next instruction.  It is either a computed goto, or a
 	 plain break.  */
-#define NEXT goto *(targets[op = FETCH])
+#define NEXT goto *(dispatch[op = FETCH])
       /* FIRST is like NEXT, but is only used at the start of the
 	 interpreter body.  In the switch-based interpreter it is the
 	 switch, so the threaded definition must include a semicolon.  */
@@ -601,6 +615,16 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 #undef DEFINE
 	};
 
+      /* The dispatch table used while byte-metering-on is non-nil.
+	 It sends every op to insn_meter, which counts it and then
+	 jumps to its entry in TARGETS.  */
+      static const void *const meter_targets[256] =
+	{
+	  [0 ... 255] = &&insn_meter
+	};
+
+      dispatch = byte_metering_on ? meter_targets : targets;
+
 #endif
 
 
@@ -643,6 +667,17 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 	    NEXT;
 	  }
 
+	/* Beq followed by Bgotoifnil.  */
+	CASE (Beq_gotoifnil):
+	  {
+	    Lisp_Object v1 = POP;
+	    Lisp_Object v2 = POP;
+	    op = FETCH2;
+	    if (!EQ (v1, v2))
+	      goto op_branch;
+	    NEXT;
+	  }
+
 	CASE (Bcar):
 	  if (CONSP (TOP))
 	    TOP = XCAR (TOP);
@@ -653,6 +688,21 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 	    }
 	  NEXT;
 
+	/* Bstack_ref6 followed by Bcar.  */
+	CASE (Bstack_ref_car):
+	  {
+	    Lisp_Object v1 = top[- FETCH];
+	    PUSH (v1);
+	    if (CONSP (v1))
+	      TOP = XCAR (v1);
+	    else if (!NILP (v1))
+	      {
+		record_in_backtrace (Qcar, &TOP, 1);
+		wrong_type_argument (Qlistp, v1);
+	      }
+	    NEXT;
+	  }
+
 	CASE (Beq):
 	  {
 	    Lisp_Object v1 = POP;
@@ -756,7 +806,6 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 	docall:
 	  {
 	    DISCARD (op);
-#ifdef BYTE_CODE_METER
 	    if (byte_metering_on && SYMBOLP (TOP))
 	      {
 		Lisp_Object v1 = TOP;
@@ -768,7 +817,6 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 		    Fput (v1, Qbyte_code_meter, v2);
 		  }
 	      }
-#endif
 	    maybe_quit ();
 
 	    if (++lisp_eval_depth > max_lisp_eval_depth)
@@ -792,7 +840,14 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 	    Lisp_Object original_fun = call_fun;
 	    /* Calls to symbols-with-pos don't need to be on the fast path.  */
 	    if (BARE_SYMBOL_P (call_fun))
-	      call_fun = XBARE_SYMBOL (call_fun)->u.s.function;
+	      {
+		call_fun = XBARE_SYMBOL (call_fun)->u.s.function;
+		/* Follow aliases here, so that calls through them take
+		   the fast paths below too.  If the chain ends in nil or
+		   an autoload, funcall_general signals or loads it.  */
+		if (BARE_SYMBOL_P (call_fun))
+		  call_fun = indirect_function (call_fun);
+	      }
 	    if (CLOSUREP (call_fun))
 	      {
 		Lisp_Object template = AREF (call_fun, CLOSURE_ARGLIST);
@@ -984,6 +1039,9 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 		   <https://gcc.gnu.org/bugzilla/show_bug.cgi?id=21161>.  */
 		bytestr_data = saved_bytestr_data;
 		vectorp = saved_vectorp;
+# ifdef BYTE_CODE_THREADED
+		dispatch = saved_dispatch;
+# endif
 #endif
 		bytestr_data = SDATA (bytestr);
 		vectorp = XVECTOR (vector)->contents;
@@ -994,6 +1052,9 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 		    bytestr_length = SCHARS (bytestr);
 		  }
 		pc = bytestr_data;
+#ifdef BYTE_CODE_THREADED
+		dispatch = byte_metering_on ? meter_targets : targets;
+#endif
 		PUSH (c->val);
 		goto op_branch;
 	      }
@@ -1002,6 +1063,9 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 #if GCC_LINT && __GNUC__ && !__clang__
 	    saved_vectorp = vectorp;
 	    saved_bytestr_data = bytestr_data;
+# ifdef BYTE_CODE_THREADED
+	    saved_dispatch = dispatch;
+# endif
 #endif
 	    NEXT;
 	  }
@@ -1641,6 +1705,7 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 	      }
 	    CHECK_IMPURE (cell, XCONS (cell));
 	    XSETCAR (cell, newval);
+	    keymap_modiff++;
 	    TOP = newval;
 	    NEXT;
 	  }
@@ -1656,6 +1721,7 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 	      }
 	    CHECK_IMPURE (cell, XCONS (cell));
 	    XSETCDR (cell, newval);
+	    keymap_modiff++;
 	    TOP = newval;
 	    NEXT;
 	  }
@@ -1783,6 +1849,12 @@ #define DEFINE(name, value) [name] = &&insn_ ## name,
 	    emacs_abort ();
 	  PUSH (vectorp[op - Bconstant]);
 	  NEXT;
+
+#ifdef BYTE_CODE_THREADED
+	insn_meter:
+	  meter_byte_op (op);
+	  goto *(targets[op]);
+#endif
 	}
     }
 
@@ -1816,26 +1888,25 @@ syms_of_bytecode (void)
   defsubr (&Sbyte_code);
   defsubr (&Sinternal_stack_stats);
 
-#ifdef BYTE_CODE_METER
-
   DEFVAR_LISP ("byte-code-meter", Vbyte_code_meter,
 	       doc: /* A vector of vectors which holds a histogram of byte-code usage.
 \(aref (aref byte-code-meter 0) CODE) indicates how many times the byte
 opcode CODE has been executed.
 \(aref (aref byte-code-meter CODE1) CODE2), where CODE1 is not 0,
 indicates how many times the byte opcodes CODE1 and CODE2 have been
-executed in succession.  */);
+executed in succession.
+This is filled in while `byte-metering-on' is non-nil.  If it is nil,
+it is set to a new histogram, so setting it to nil clears the counts.  */);
 
   DEFVAR_BOOL ("byte-metering-on", byte_metering_on,
 	       doc: /* If non-nil, keep profiling information on byte code usage.
 The variable byte-code-meter indicates how often each byte opcode is used.
 If a symbol has a property named `byte-code-meter' whose value is an
-integer, it is incremented each time that symbol's function is called.  */);
+integer, it is incremented each time that symbol's function is called.
+Setting this takes effect at the next call to a byte-compiled function.
+See also `byte-compile-report-ops'.  */);
 
   byte_metering_on = false;
-  Vbyte_code_meter = make_nil_vector (256);
+  Vbyte_code_meter = Qnil;
   DEFSYM (Qbyte_code_meter, "byte-code-meter");
-  for (int i = 0; i < 256; i++)
-    ASET (Vbyte_code_meter, i, make_vector (256, make_fixnum (0)));
-#endif
 }
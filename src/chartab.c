@@ -542,6 +542,7 @@ DEFUN ("set-char-table-parent", Fset_char_table_parent, Sset_char_table_parent,
     }
 
   set_char_table_parent (char_table, parent);
+  keymap_modiff++;
 
   return parent;
 }
@@ -638,6 +639,7 @@ DEFUN ("set-char-table-range", Fset_char_table_range, Sset_char_table_range,
   else
     error ("Invalid RANGE argument to `set-char-table-range'");
 
+  keymap_modiff++;
   return value;
 }
 
@@ -1125,6 +1125,46 @@ #define UTF_8_BOM_1 0xEF
 #define UTF_8_BOM_2 0xBB
 #define UTF_8_BOM_3 0xBF
 
+/* Return the number of bytes at the start of the NBYTES bytes at SRC
+   that are printable ASCII characters, tabs or newlines, or if
+   EIGHT_BIT, also bytes with the high bit set.  Look at a word of
+   bytes at a time, and set EOL_SEEN_LF in *EOL_SEEN if there is a
+   newline among them.  The value is a multiple of the word size, so
+   the caller must look at the following bytes one by one.  */
+
+static ptrdiff_t
+skip_plain_text_words (const unsigned char *src, ptrdiff_t nbytes,
+		       bool eight_bit, int *eol_seen)
+{
+  typedef unsigned long long int word;
+  word const ones = (word) -1 / UCHAR_MAX;
+  word const high_bits = ones << (CHAR_BIT - 1);
+  const unsigned char *p = src;
+
+  for (; sizeof (word) <= nbytes; p += sizeof (word), nbytes -= sizeof (word))
+    {
+      word w;
+      memcpy (&w, p, sizeof w);
+      if (!eight_bit && w & high_bits)
+	break;
+
+      /* Adding at most 0x80 to the low 7 bits of a byte cannot carry
+	 into the next byte, so this sets the high bit of each byte of
+	 CONTROL if and only if the byte is a control character, and
+	 likewise for NEWLINE and TAB.  */
+      word low = w & ~high_bits;
+      word lf = low ^ (ones * '\n'), tab = low ^ (ones * '\t');
+      word control = ~(low + ones * (0x80 - ' ')) & ~w & high_bits;
+      word newline = ~((lf + ones * 0x7F) | lf) & ~w & high_bits;
+      word tab_char = ~((tab + ones * 0x7F) | tab) & ~w & high_bits;
+      if (control & ~newline & ~tab_char)
+	break;
+      if (newline)
+	*eol_seen |= EOL_SEEN_LF;
+    }
+  return p - src;
+}
+
 /* Unlike the other detect_coding_XXX, this function counts the number
    of characters and checks the EOL format.  */
 
@@ -1158,6 +1198,15 @@ detect_coding_utf_8 (struct coding_system *coding,
     {
       int c, c1, c2, c3, c4;
 
+      if (! multibytep)
+	{
+	  int eol_seen = EOL_SEEN_NONE;
+	  ptrdiff_t ascii = skip_plain_text_words (src, src_end - src, false,
+						   &eol_seen);
+	  src += ascii;
+	  nchars += ascii;
+	}
+
       src_base = src;
       ONE_MORE_BYTE (c);
       if (c < 0 || UTF_8_1_OCTET_P (c))
@@ -6178,8 +6227,11 @@ check_ascii (struct coding_system *coding)
       || SYMBOLP (eol_type))
     {
       /* We don't have to check EOL format.  */
-      while (src < end && !( *src & 0x80))
+      while (src < end)
 	{
+	  src += skip_plain_text_words (src, end - src, false, &eol_seen);
+	  if (src == end || *src & 0x80)
+	    break;
 	  if (*src++ == '\n')
 	    eol_seen |= EOL_SEEN_LF;
 	}
@@ -6189,6 +6241,10 @@ check_ascii (struct coding_system *coding)
       end--;		    /* We look ahead one byte for "CR LF".  */
       while (src < end)
 	{
+	  src += skip_plain_text_words (src, end - src, false, &eol_seen);
+	  if (src == end)
+	    break;
+
 	  int c = *src;
 
 	  if (c & 0x80)
@@ -6256,6 +6312,14 @@ check_utf_8 (struct coding_system *coding)
 
       if (UTF_8_1_OCTET_P (*src))
 	{
+	  ptrdiff_t ascii = skip_plain_text_words (src, end - src, false,
+						   &eol_seen);
+	  if (ascii)
+	    {
+	      src += ascii;
+	      nchars += ascii;
+	      continue;
+	    }
 	  src++;
 	  if (c < 0x20)
 	    {
@@ -6547,6 +6611,20 @@ detect_coding (struct coding_system *coding)
       coding->head_ascii = 0;
       for (src = coding->source; src < src_end; src++)
 	{
+	  int eol_seen = EOL_SEEN_NONE;
+	  ptrdiff_t plain = skip_plain_text_words (src, src_end - src,
+						   eight_bit_found, &eol_seen);
+	  if (plain)
+	    {
+	      src += plain;
+	      if (! eight_bit_found)
+		coding->head_ascii += plain;
+	      if (! disable_ascii_optimization && ! inhibit_eol_conversion)
+		coding->eol_seen |= eol_seen;
+	      if (src == src_end)
+		break;
+	    }
+
 	  c = *src;
 	  if (c & 0x80)
 	    {
@@ -7911,6 +7989,49 @@ coding_restore_undo_list (Lisp_Object arg)
   bset_undo_list (buf, undo_list);
 }
 
+/* If CODING decodes every byte by itself to a character, as the
+   single-byte charset coding systems and raw-text do, store in TABLE
+   the character each byte decodes to and return true.  Store in
+   *CHARSET the charset that decode_coding_charset records in the
+   `charset' text property of the decoded text, or NULL if none.  A
+   byte that CODING cannot decode gets -1.  */
+
+static bool
+single_byte_decoding_table (struct coding_system *coding, int table[256],
+			    struct charset **charset)
+{
+  Lisp_Object attrs = CODING_ID_ATTRS (coding->id);
+  Lisp_Object charset_list, valids;
+  int c;
+
+  *charset = NULL;
+  if (coding->decoder == decode_coding_raw_text)
+    {
+      for (c = 0; c < 256; c++)
+	table[c] = c < 0x80 ? c : BYTE8_TO_CHAR (c);
+      return true;
+    }
+  if (coding->decoder != decode_coding_charset)
+    return false;
+  charset_list = CODING_ATTR_CHARSET_LIST (attrs);
+  if (! CONSP (charset_list) || ! NILP (XCDR (charset_list)))
+    return false;
+  struct charset *cs = CHARSET_FROM_ID (XFIXNUM (XCAR (charset_list)));
+  if (CHARSET_DIMENSION (cs) != 1)
+    return false;
+  valids = AREF (attrs, coding_attr_charset_valids);
+  for (c = 0; c < 256; c++)
+    {
+      Lisp_Object val = AREF (valids, c);
+
+      table[c] = (FIXNUMP (val) && XFIXNUM (val) == cs->id
+		  ? DECODE_CHAR (cs, c) : -1);
+    }
+  if (cs->id != charset_ascii)
+    *charset = cs;
+  return true;
+}
+
 /* Decode the *last* BYTES of the gap and insert them at point.  */
 void
 decode_coding_gap (struct coding_system *coding, ptrdiff_t bytes)
@@ -7945,13 +8066,20 @@ decode_coding_gap (struct coding_system *coding, ptrdiff_t bytes)
       && NILP (get_translation_table (attrs, 0, NULL)))
     {
       ptrdiff_t chars = coding->head_ascii;
+      int table[256];
+      struct charset *charset = NULL;
+      ptrdiff_t nbytes = -1;
+
       if (chars < 0)
 	chars = check_ascii (coding);
       if (chars != bytes)
 	{
 	  /* There exists a non-ASCII byte.  */
 	  if (EQ (CODING_ATTR_TYPE (attrs), Qutf_8)
-	      && coding->detected_utf8_bytes == coding->src_bytes)
+	      && (coding->detected_utf8_bytes == coding->src_bytes
+		  /* check_utf_8 can tell whether the text is valid UTF-8
+		     if detection did not look at it.  */
+		  || coding->detected_utf8_bytes < 0))
 	    {
 	      if (coding->detected_utf8_chars >= 0)
 		chars = coding->detected_utf8_chars;
@@ -7968,6 +8096,48 @@ decode_coding_gap (struct coding_system *coding, ptrdiff_t bytes)
 		  coding->src_bytes -= 3;
 		}
 	    }
+	  else if (coding->dst_multibyte
+		   && single_byte_decoding_table (coding, table, &charset))
+	    {
+	      /* Each byte is one character, so we need only the number
+		 of bytes the decoded text will occupy, and the EOL
+		 format after the ASCII head.  Leave text with a byte
+		 that can't be decoded to decode_coding.  */
+	      const unsigned char *src = GAP_END_ADDR - bytes + chars;
+	      const unsigned char *src_end = GAP_END_ADDR;
+	      int eol_seen = coding->eol_seen;
+	      unsigned char lens[256];
+
+	      for (int c = 0; c < 256; c++)
+		lens[c] = table[c] < 0 ? 0 : CHAR_BYTES (table[c]);
+	      nbytes = chars;
+	      chars = bytes;
+	      while (src < src_end)
+		{
+		  int c = *src++;
+
+		  if (! lens[c])
+		    {
+		      chars = nbytes = -1;
+		      break;
+		    }
+		  nbytes += lens[c];
+		  if (c == '\r')
+		    {
+		      if (src < src_end && *src == '\n')
+			{
+			  eol_seen |= EOL_SEEN_CRLF;
+			  src++;
+			  nbytes++;
+			}
+		      else
+			eol_seen |= EOL_SEEN_CR;
+		    }
+		  else if (c == '\n')
+		    eol_seen |= EOL_SEEN_LF;
+		}
+	      coding->eol_seen = eol_seen;
+	    }
 	  else
 	    chars = -1;
 	}
@@ -8008,10 +8178,50 @@ decode_coding_gap (struct coding_system *coding, ptrdiff_t bytes)
 	      diff = dst - src;
 	      bytes -= diff;
 	      chars -= diff;
+	      nbytes -= diff;
+	    }
+	  if (nbytes >= 0)
+	    {
+	      /* Decode the text from the tail of the gap to its head.
+		 As no byte decodes to less than one byte, the decoded
+		 text never overtakes what remains to be decoded once
+		 the gap can hold all of it.  */
+	      const unsigned char *src, *src_end;
+	      unsigned char *dst;
+
+	      if (GAP_SIZE < nbytes)
+		coding_alloc_by_making_gap (coding, 0, nbytes - GAP_SIZE);
+	      src_end = GAP_END_ADDR;
+	      src = src_end - bytes;
+	      for (dst = GPT_ADDR; src < src_end; src++)
+		{
+		  int c = table[*src];
+
+		  if (ASCII_CHAR_P (c))
+		    *dst++ = c;
+		  else
+		    dst += CHAR_STRING (c, dst);
+		}
+	      bytes = nbytes;
 	    }
 	  coding->produced = bytes;
 	  coding->produced_char = chars;
-	  insert_from_gap (chars, bytes, 1, coding->insert_before_markers);
+	  insert_from_gap (chars, bytes, nbytes < 0,
+			   coding->insert_before_markers);
+	  if (charset && chars > 0)
+	    {
+	      /* Record the charset as decode_coding_charset does, with
+		 undo disabled as decode_coding does it.  */
+	      Lisp_Object undo_list = BVAR (current_buffer, undo_list);
+
+	      record_unwind_protect (coding_restore_undo_list,
+				     Fcons (undo_list, Fcurrent_buffer ()));
+	      bset_undo_list (current_buffer, Qt);
+	      Fput_text_property (make_fixnum (coding->dst_pos),
+				  make_fixnum (coding->dst_pos + chars),
+				  Qcharset, CHARSET_NAME (charset), Qnil);
+	      unbind_to (count, Qnil);
+	    }
 	  return;
 	}
     }
@@ -8273,6 +8483,196 @@ decode_coding_object (struct coding_system *coding,
 }
 
 
+/* Return the number of bytes at the start of the NBYTES bytes of
+   multibyte text at SRC that CODING would encode into the same bytes.
+   Return -1 if CODING changes all text, i.e. unless it is a UTF-8
+   coding system that needs no BOM, EOL conversion, translation or
+   pre-write conversion; such coding systems encode every character
+   except raw bytes into its internal representation.  */
+
+ptrdiff_t
+encode_coding_unchanged_bytes (struct coding_system *coding,
+			       const unsigned char *src, ptrdiff_t nbytes)
+{
+  Lisp_Object attrs = CODING_ID_ATTRS (coding->id);
+  Lisp_Object eol_type = CODING_ID_EOL_TYPE (coding->id);
+
+  if (! EQ (CODING_ATTR_TYPE (attrs), Qutf_8)
+      || CODING_UTF_8_BOM (coding) != utf_without_bom
+      || ! (inhibit_eol_conversion || VECTORP (eol_type)
+	    || EQ (eol_type, Qunix))
+      || coding->mode & CODING_MODE_SELECTIVE_DISPLAY
+      || CODING_REQUIRE_ANNOTATION (coding)
+      || ! NILP (CODING_ATTR_PRE_WRITE (attrs))
+      || ! NILP (get_translation_table (attrs, true, NULL)))
+    return -1;
+
+  /* Stop at the first raw byte, whose two-byte internal form starts
+     with 0xC0 or 0xC1.  Look at blocks of bytes in a way that
+     compilers can vectorize.  */
+  enum { BLOCK = 64 };
+  const unsigned char *p = src, *end = src + nbytes;
+  for (; BLOCK <= end - p; p += BLOCK)
+    {
+      bool raw = false;
+      for (int i = 0; i < BLOCK; i++)
+	raw |= (p[i] & 0xFE) == 0xC0;
+      if (raw)
+	break;
+    }
+  while (p < end && (*p & 0xFE) != 0xC0)
+    p++;
+  return p - src;
+}
+
+/* If CODING encodes characters one byte each with a single charset,
+   as the single-byte charset coding systems do, and needs no EOL
+   conversion, translation or pre-write conversion, encode up to
+   NCHARS characters of the multibyte text of the current buffer from
+   FROM_BYTE to TO_BYTE, which must not span the gap.  Store the
+   result in CODING->destination, which the caller must free, as
+   encode_coding_object does when CODING->raw_destination is set, and
+   return the number of characters encoded, which is also the number
+   of bytes produced.  Return -1 if CODING is not such a coding
+   system.  */
+
+ptrdiff_t
+encode_coding_single_bytes (struct coding_system *coding,
+			    ptrdiff_t from_byte, ptrdiff_t to_byte,
+			    ptrdiff_t nchars)
+{
+  Lisp_Object attrs = CODING_ID_ATTRS (coding->id);
+  Lisp_Object eol_type = CODING_ID_EOL_TYPE (coding->id);
+  struct charset *charset;
+  int table[256];
+
+  if (coding->encoder != encode_coding_charset
+      || ! (inhibit_eol_conversion || VECTORP (eol_type)
+	    || EQ (eol_type, Qunix))
+      || coding->mode & CODING_MODE_SELECTIVE_DISPLAY
+      || CODING_REQUIRE_ANNOTATION (coding)
+      || ! NILP (CODING_ATTR_PRE_WRITE (attrs))
+      || ! NILP (get_translation_table (attrs, true, NULL))
+      || ! single_byte_decoding_table (coding, table, &charset))
+    return -1;
+  if (! charset)
+    charset = CHARSET_FROM_ID (charset_ascii);
+
+  /* Map the characters back to the bytes, as encode_coding_charset
+     would, through a small open-addressed hash table.  */
+  enum { NSLOTS = 512 };
+  int slot_char[NSLOTS];
+  unsigned char slot_byte[NSLOTS];
+  for (int i = 0; i < NSLOTS; i++)
+    slot_char[i] = -1;
+  for (int b = 0; b < 256; b++)
+    {
+      int c = table[b];
+      if (c >= 0 && ENCODE_CHAR (charset, c) == b)
+	{
+	  int i = (c * 2654435761u) >> 23;
+	  while (slot_char[i] >= 0 && slot_char[i] != c)
+	    i = (i + 1) % NSLOTS;
+	  slot_char[i] = c;
+	  slot_byte[i] = b;
+	}
+    }
+
+  bool ascii_compatible = ! NILP (CODING_ATTR_ASCII_COMPAT (attrs));
+  ptrdiff_t size = min (to_byte - from_byte, nchars);
+  unsigned char *dst = xmalloc (size);
+  unsigned char *d = dst, *dst_end = dst + size;
+
+  /* Compute the text address only now, as getting the charset map
+     above may have relocated buffer text.  */
+  const unsigned char *p = BYTE_POS_ADDR (from_byte);
+  const unsigned char *end = p + (to_byte - from_byte);
+  while (d < dst_end && p < end)
+    {
+      int len, c = *p;
+
+      if (ascii_compatible && ASCII_CHAR_P (c))
+	{
+	  *d++ = c;
+	  p++;
+	  continue;
+	}
+      c = string_char_and_length (p, &len);
+      p += len;
+      if (CHAR_BYTE8_P (c))
+	{
+	  *d++ = CHAR_TO_BYTE8 (c);
+	  continue;
+	}
+
+      int i = (c * 2654435761u) >> 23;
+      while (slot_char[i] >= 0 && slot_char[i] != c)
+	i = (i + 1) % NSLOTS;
+      if (slot_char[i] >= 0)
+	{
+	  *d++ = slot_byte[i];
+	  continue;
+	}
+
+      /* A character that no byte decodes to.  */
+      ptrdiff_t pos_byte = to_byte - (end - p);
+      charset_map_loaded = false;
+      unsigned code = ENCODE_CHAR (charset, c);
+      if (charset_map_loaded)
+	{
+	  p = BYTE_POS_ADDR (pos_byte);
+	  end = p + (to_byte - pos_byte);
+	}
+      if (code != CHARSET_INVALID_CODE (charset))
+	*d++ = code;
+      else if (coding->mode & CODING_MODE_SAFE_ENCODING)
+	*d++ = CODING_INHIBIT_CHARACTER_SUBSTITUTION;
+      else
+	*d++ = coding->default_char;
+    }
+
+  coding->destination = dst;
+  coding->raw_destination = 1;
+  coding->produced = coding->consumed_char = d - dst;
+  return d - dst;
+}
+
+/* Return the number of bytes at the start of the NBYTES bytes of
+   multibyte text at SRC that CODING would decode from the same bytes.
+   Return -1 if CODING changes all text, i.e. unless it is a UTF-8
+   coding system that needs no BOM, EOL conversion, translation or
+   post-read conversion; such coding systems decode valid UTF-8 into
+   the same bytes.  Raw bytes, surrogates and characters beyond the
+   Unicode range are not valid UTF-8.  */
+
+ptrdiff_t
+decode_coding_unchanged_bytes (struct coding_system *coding,
+			       const unsigned char *src, ptrdiff_t nbytes)
+{
+  Lisp_Object attrs = CODING_ID_ATTRS (coding->id);
+
+  if (! EQ (CODING_ATTR_TYPE (attrs), Qutf_8)
+      || CODING_UTF_8_BOM (coding) != utf_without_bom
+      || ! (inhibit_eol_conversion
+	    || EQ (CODING_ID_EOL_TYPE (coding->id), Qunix))
+      || ! NILP (CODING_ATTR_POST_READ (attrs))
+      || ! NILP (get_translation_table (attrs, false, NULL)))
+    return -1;
+
+  const unsigned char *p = src, *end = src + nbytes;
+  while (p < end)
+    {
+      int c = *p;
+
+      if ((c & 0xFE) == 0xC0 || 0xF5 <= c
+	  || (c == 0xED && (p + 1 == end || 0xA0 <= p[1]))
+	  || (c == 0xF4 && (p + 1 == end || 0x90 <= p[1])))
+	break;
+      p++;
+    }
+  return p - src;
+}
+
 /* Encode the text in the range FROM/FROM_BYTE and TO/TO_BYTE in
    SRC_OBJECT into DST_OBJECT by coding context CODING.
 
@@ -8740,6 +9140,18 @@ detect_coding_system (const unsigned char *src,
       /* Skip all ASCII bytes except for a few ISO2022 controls.  */
       for (; src < src_end; src++)
 	{
+	  int eol_seen = EOL_SEEN_NONE;
+	  ptrdiff_t plain = skip_plain_text_words (src, src_end - src,
+						   eight_bit_found, &eol_seen);
+	  if (plain)
+	    {
+	      src += plain;
+	      if (! eight_bit_found)
+		coding.head_ascii += plain;
+	      if (src == src_end)
+		break;
+	    }
+
 	  c = *src;
 	  if (c & 0x80)
 	    {
@@ -708,6 +708,12 @@ #define UTF_16_LOW_SURROGATE_P(val) \
 extern void decode_coding_object (struct coding_system *,
                                   Lisp_Object, ptrdiff_t, ptrdiff_t,
                                   ptrdiff_t, ptrdiff_t, Lisp_Object);
+extern ptrdiff_t decode_coding_unchanged_bytes (struct coding_system *,
+						const unsigned char *, ptrdiff_t);
+extern ptrdiff_t encode_coding_unchanged_bytes (struct coding_system *,
+						const unsigned char *, ptrdiff_t);
+extern ptrdiff_t encode_coding_single_bytes (struct coding_system *,
+					     ptrdiff_t, ptrdiff_t, ptrdiff_t);
 extern void encode_coding_object (struct coding_system *,
                                   Lisp_Object, ptrdiff_t, ptrdiff_t,
                                   ptrdiff_t, ptrdiff_t, Lisp_Object);
@@ -469,7 +469,7 @@ load_gccjit_if_necessary (bool mandatory)
 
 
 /* Increase this number to force a new Vcomp_abi_hash to be generated.  */
-#define ABI_VERSION "6"
+#define ABI_VERSION "7"
 
 /* Length of the hashes used for eln file naming.  */
 #define HASH_LENGTH 8
@@ -478,6 +478,7 @@ #define HASH_LENGTH 8
 #define CURRENT_THREAD_RELOC_SYM "current_thread_reloc"
 #define F_SYMBOLS_WITH_POS_ENABLED_RELOC_SYM "f_symbols_with_pos_enabled_reloc"
 #define PURE_RELOC_SYM "pure_reloc"
+#define KEYMAP_MODIFF_RELOC_SYM "keymap_modiff_reloc"
 #define DATA_RELOC_SYM "d_reloc"
 #define DATA_RELOC_IMPURE_SYM "d_reloc_imp"
 #define DATA_RELOC_EPHEMERAL_SYM "d_reloc_eph"
@@ -621,6 +622,7 @@ #define F_RELOC_MAX_SIZE 1600
   gcc_jit_rvalue *current_thread_ref;
   /* Other globals.  */
   gcc_jit_rvalue *pure_ptr;
+  gcc_jit_rvalue *keymap_modiff_ref;
 #ifndef LIBGCCJIT_HAVE_gcc_jit_context_new_bitcast
   /* This version of libgccjit has really limited support for casting
      therefore this union will be used for the scope.  */
@@ -3049,6 +3051,15 @@ emit_ctxt_code (void)
         comp.void_ptr_type,
 	PURE_RELOC_SYM));
 
+  comp.keymap_modiff_ref =
+    gcc_jit_lvalue_as_rvalue (
+      gcc_jit_context_new_global (
+	comp.ctxt,
+	NULL,
+	GCC_JIT_GLOBAL_EXPORTED,
+	gcc_jit_type_get_pointer (comp.emacs_uint_type),
+	KEYMAP_MODIFF_RELOC_SYM));
+
   gcc_jit_context_new_global (
 	comp.ctxt,
 	NULL,
@@ -3731,6 +3742,19 @@ define_setcar_setcdr (void)
 	emit_XSETCDR (gcc_jit_param_as_rvalue (cell),
 		      gcc_jit_param_as_rvalue (new_el));
 
+      /* keymap_modiff++;  */
+      gcc_jit_lvalue *modiff =
+	gcc_jit_rvalue_dereference (comp.keymap_modiff_ref, NULL);
+      gcc_jit_block_add_assignment (
+	entry_block,
+	NULL,
+	modiff,
+	emit_binary_op (GCC_JIT_BINARY_OP_PLUS,
+			comp.emacs_uint_type,
+			gcc_jit_lvalue_as_rvalue (modiff),
+			gcc_jit_context_new_rvalue_from_int (
+			  comp.ctxt, comp.emacs_uint_type, 1)));
+
       /* return newel;  */
       gcc_jit_block_end_with_return (entry_block,
 				     NULL,
@@ -5378,6 +5402,8 @@ load_comp_unit (struct Lisp_Native_Comp_Unit *comp_u, bool loading_dump,
       bool **f_symbols_with_pos_enabled_reloc =
 	dynlib_sym (handle, F_SYMBOLS_WITH_POS_ENABLED_RELOC_SYM);
       void **pure_reloc = dynlib_sym (handle, PURE_RELOC_SYM);
+      EMACS_UINT **keymap_modiff_reloc =
+	dynlib_sym (handle, KEYMAP_MODIFF_RELOC_SYM);
       Lisp_Object *data_relocs = dynlib_sym (handle, DATA_RELOC_SYM);
       Lisp_Object *data_imp_relocs = comp_u->data_imp_relocs;
       void **freloc_link_table = dynlib_sym (handle, FUNC_LINK_TABLE_SYM);
@@ -5385,6 +5411,7 @@ load_comp_unit (struct Lisp_Native_Comp_Unit *comp_u, bool loading_dump,
       if (!(current_thread_reloc
 	    && f_symbols_with_pos_enabled_reloc
 	    && pure_reloc
+	    && keymap_modiff_reloc
 	    && data_relocs
 	    && data_imp_relocs
 	    && data_eph_relocs
@@ -5397,6 +5424,7 @@ load_comp_unit (struct Lisp_Native_Comp_Unit *comp_u, bool loading_dump,
       *current_thread_reloc = &current_thread;
       *f_symbols_with_pos_enabled_reloc = &symbols_with_pos_enabled;
       *pure_reloc = pure;
+      *keymap_modiff_reloc = &keymap_modiff;
 
       /* Imported functions.  */
       *freloc_link_table = freloc.link_table;
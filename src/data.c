@@ -689,6 +689,14 @@ DEFUN ("cdr-safe", Fcdr_safe, Scdr_safe, 1, 1, 0,
   return CDR_SAFE (object);
 }
 
+/* Incremented whenever the car or cdr of a cons, an element or the
+   parent of a char-table or the function definition of a symbol is
+   set, since that may change what a keymap binds.  keymap.c uses it to
+   tell when its cache of keymap lookups is out of date, and increments
+   it itself when it changes a keymap.  Stores into plain vectors do not
+   increment it; keymap.c does not cache what it finds in them.  */
+EMACS_UINT keymap_modiff;
+
 DEFUN ("setcar", Fsetcar, Ssetcar, 2, 2, 0,
        doc: /* Set the car of CELL to be NEWCAR.  Returns NEWCAR.  */)
   (register Lisp_Object cell, Lisp_Object newcar)
@@ -696,6 +704,7 @@ DEFUN ("setcar", Fsetcar, Ssetcar, 2, 2, 0,
   CHECK_CONS (cell);
   CHECK_IMPURE (cell, XCONS (cell));
   XSETCAR (cell, newcar);
+  keymap_modiff++;
   return newcar;
 }
 
@@ -706,6 +715,7 @@ DEFUN ("setcdr", Fsetcdr, Ssetcdr, 2, 2, 0,
   CHECK_CONS (cell);
   CHECK_IMPURE (cell, XCONS (cell));
   XSETCDR (cell, newcdr);
+  keymap_modiff++;
   return newcdr;
 }
 
@@ -796,6 +806,7 @@ DEFUN ("fmakunbound", Ffmakunbound, Sfmakunbound, 1, 1, 0,
   if (NILP (symbol) || EQ (symbol, Qt))
     xsignal1 (Qsetting_constant, symbol);
   set_symbol_function (symbol, Qnil);
+  keymap_modiff++;
   return symbol;
 }
 
@@ -915,6 +926,7 @@ DEFUN ("fset", Ffset, Sfset, 2, 2, 0,
 #endif
 
   set_symbol_function (symbol, definition);
+  keymap_modiff++;
 
   return definition;
 }
@@ -2610,6 +2622,7 @@ DEFUN ("aset", Faset, Saset, 3, 3, 0,
     {
       CHECK_CHARACTER (idx);
       CHAR_TABLE_SET (array, idxval, newelt);
+      keymap_modiff++;
     }
   else if (RECORDP (array))
     {
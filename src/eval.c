@@ -3524,6 +3524,12 @@ specbind (Lisp_Object symbol, Lisp_Object value)
       specpdl_ptr->let.symbol = symbol;
       specpdl_ptr->let.old_value = SYMBOL_VAL (sym);
       specpdl_ptr->let.where.kbd = NULL;
+      if (sym->u.s.trapped_write == SYMBOL_UNTRAPPED_WRITE)
+	{
+	  grow_specpdl ();
+	  SET_SYMBOL_VAL (sym, value);
+	  return;
+	}
       break;
     case SYMBOL_LOCALIZED:
     case SYMBOL_FORWARDED:
@@ -3797,8 +3803,24 @@ unbind_to (specpdl_ref count, Lisp_Object value)
 
   Vquit_flag = Qnil;
 
-  while (specpdl_ptr != specpdl_ref_to_ptr (count))
+  union specbinding *stop = specpdl_ref_to_ptr (count);
+  while (specpdl_ptr != stop)
     {
+      /* Bindings of plain variables are the most common entries, and
+	 undoing them runs no code, so undo them in place.  */
+      union specbinding *bind = specpdl_ptr - 1;
+      if (bind->kind == SPECPDL_LET)
+	{
+	  struct Lisp_Symbol *sym = XBARE_SYMBOL (specpdl_symbol (bind));
+	  if (sym->u.s.redirect == SYMBOL_PLAINVAL
+	      && sym->u.s.trapped_write == SYMBOL_UNTRAPPED_WRITE)
+	    {
+	      specpdl_ptr = bind;
+	      SET_SYMBOL_VAL (sym, specpdl_old_value (bind));
+	      continue;
+	    }
+	}
+
       /* Copy the binding, and decrement specpdl_ptr, before we do
 	 the work to unbind it.  We decrement first
 	 so that an error in unbinding won't try to unbind
@@ -4027,6 +4027,53 @@ maybe_move_gap (struct buffer *b)
     }
 }
 
+/* Return true if decoding text with CODING into the current buffer
+   leaves the bytes of valid UTF-8 unchanged.  */
+
+static bool
+decoding_keeps_utf_8 (struct coding_system *coding)
+{
+  return (! NILP (BVAR (current_buffer, enable_multibyte_characters))
+	  && decode_coding_unchanged_bytes (coding, NULL, 0) == 0);
+}
+
+/* Return the number of bytes from FROM to TO in the current buffer
+   that decoding the same bytes in a file would produce.  That is the
+   valid UTF-8 if decoding with CODING leaves it unchanged, and the
+   printable ASCII if CODING is yet to be detected; control characters
+   such as ESC and NUL could change what detection finds.  */
+
+static ptrdiff_t
+unchanged_by_decoding (struct coding_system *coding,
+		       ptrdiff_t from, ptrdiff_t to)
+{
+  ptrdiff_t pos = from;
+
+  while (pos < to)
+    {
+      ptrdiff_t end = pos < GPT_BYTE ? min (to, GPT_BYTE) : to;
+      unsigned char *p = BYTE_POS_ADDR (pos);
+      ptrdiff_t n = 0;
+
+      if (! CODING_REQUIRE_DETECTION (coding))
+	n = max (0, decode_coding_unchanged_bytes (coding, p, end - pos));
+      else
+	while (n < end - pos
+	       && (p[n] == '\t' || p[n] == '\n' || p[n] == '\r'
+		   || (' ' <= p[n] && p[n] < 0177)))
+	  n++;
+      pos += n;
+      if (pos < end)
+	break;
+    }
+
+  /* A character cut short at TO would decode into raw bytes.  */
+  if (pos < ZV_BYTE)
+    while (pos > from && ! CHAR_HEAD_P (FETCH_BYTE (pos)))
+      pos--;
+  return pos - from;
+}
+
 /* FIXME: insert-file-contents should be split with the top-level moved to
    Elisp and only the core kept in C.  */
 
@@ -4379,7 +4426,8 @@ DEFUN ("insert-file-contents", Finsert_file_contents, Sinsert_file_contents,
      that preserves markers pointing to the unchanged parts.
 
      Here we implement this feature in an optimized way
-     for the case where code conversion is NOT needed.
+     for the case where code conversion is NOT needed, or
+     doesn't change the bytes of valid UTF-8.
      The following if-statement handles the case of conversion
      in a less optimal way.
 
@@ -4387,12 +4435,18 @@ DEFUN ("insert-file-contents", Finsert_file_contents, Sinsert_file_contents,
      method and hope for the best.
      But if we discover the need for conversion, we give up on this method
      and let the following if-statement handle the replace job.  */
+  /* CODING_REQUIRE_DECODING depends on this.  */
+  coding.dst_multibyte
+    = !NILP (BVAR (current_buffer, enable_multibyte_characters));
   if ((!NILP (replace)
        && !BASE_EQ (replace, Qunbound))
       && BEGV < ZV
       && (NILP (coding_system)
-	  || ! CODING_REQUIRE_DECODING (&coding)))
+	  || ! CODING_REQUIRE_DECODING (&coding)
+	  || CODING_REQUIRE_DETECTION (&coding)
+	  || decoding_keeps_utf_8 (&coding)))
     {
+      Lisp_Object decided_coding_system = coding_system;
       ptrdiff_t overlap;
       /* There is still a possibility we will find the need to do code
 	 conversion.  If that happens, set this variable to
@@ -4423,7 +4477,9 @@ DEFUN ("insert-file-contents", Finsert_file_contents, Sinsert_file_contents,
 	      setup_coding_system (coding_system, &coding);
 	    }
 
-	  if (CODING_REQUIRE_DECODING (&coding))
+	  if (CODING_REQUIRE_DECODING (&coding)
+	      && ! CODING_REQUIRE_DETECTION (&coding)
+	      && ! decoding_keeps_utf_8 (&coding))
 	    /* We found that the file should be decoded somehow.
                Let's give up here.  */
 	    {
@@ -4433,22 +4489,36 @@ DEFUN ("insert-file-contents", Finsert_file_contents, Sinsert_file_contents,
 
 	  int bufpos = 0;
 	  while (bufpos < nread && same_at_start < ZV_BYTE
-		 && FETCH_BYTE (same_at_start) == read_buf[bufpos])
+		 && (FETCH_BYTE (same_at_start)
+		     == (unsigned char) read_buf[bufpos]))
 	    same_at_start++, bufpos++;
 	  /* If we found a discrepancy, stop the scan.
 	     Otherwise loop around and scan the next bufferful.  */
 	  if (bufpos != nread)
 	    break;
 	}
+      if (giveup_match_end)
+	;
+      else if (CODING_REQUIRE_DETECTION (&coding)
+	       && ! inhibit_eol_conversion
+	       && ! EQ (CODING_ID_EOL_TYPE (coding.id), Qunix))
+	/* Until a lone newline is seen, decoding the whole file could
+	   still convert the EOLs of the text that matched.  */
+	giveup_match_end = true;
+      else if (CODING_REQUIRE_DECODING (&coding))
+	same_at_start = BEGV_BYTE + unchanged_by_decoding (&coding, BEGV_BYTE,
+							   same_at_start);
       /* If the file matches the buffer completely,
 	 there's no need to replace anything.  */
-      if (same_at_start - BEGV_BYTE == end_offset - beg_offset)
+      if (! giveup_match_end
+	  && same_at_start - BEGV_BYTE == end_offset - beg_offset)
 	{
 	  emacs_fd_close (fd);
 	  clear_unwind_protect (fd_index);
 
 	  /* Truncate the buffer to the size of the file.  */
-	  del_range_1 (same_at_start, same_at_end, 0, 0);
+	  del_range_both (BYTE_TO_CHAR (same_at_start), same_at_start,
+			  BYTE_TO_CHAR (same_at_end), same_at_end, false);
 	  goto handled;
 	}
 
@@ -4489,7 +4559,8 @@ DEFUN ("insert-file-contents", Finsert_file_contents, Sinsert_file_contents,
 	  /* Compare with same_at_start to avoid counting some buffer text
 	     as matching both at the file's beginning and at the end.  */
 	  while (bufpos > 0 && same_at_end > same_at_start
-		 && FETCH_BYTE (same_at_end - 1) == read_buf[bufpos - 1])
+		 && (FETCH_BYTE (same_at_end - 1)
+		     == (unsigned char) read_buf[bufpos - 1]))
 	    same_at_end--, bufpos--;
 
 	  /* If we found a discrepancy, stop the scan.
@@ -4501,7 +4572,8 @@ DEFUN ("insert-file-contents", Finsert_file_contents, Sinsert_file_contents,
 	      if (same_at_end > same_at_start
 		  && FETCH_BYTE (same_at_end - 1) >= 0200
 		  && ! NILP (BVAR (current_buffer, enable_multibyte_characters))
-		  && (CODING_MAY_REQUIRE_DECODING (&coding)))
+		  && (CODING_MAY_REQUIRE_DECODING (&coding))
+		  && ! decoding_keeps_utf_8 (&coding))
 		giveup_match_end = true;
 	      break;
 	    }
@@ -4510,6 +4582,16 @@ DEFUN ("insert-file-contents", Finsert_file_contents, Sinsert_file_contents,
 	    break;
 	}
 
+      if (giveup_match_end)
+	{
+	  /* Let the code below detect the coding system and compare
+	     the decoded text with the buffer as usual.  */
+	  coding_system = decided_coding_system;
+	  setup_coding_system (coding_system, &coding);
+	  same_at_start = BEGV_BYTE;
+	  same_at_end = ZV_BYTE;
+	}
+
       if (! giveup_match_end)
 	{
 	  ptrdiff_t temp;
@@ -4517,6 +4599,16 @@ DEFUN ("insert-file-contents", Finsert_file_contents, Sinsert_file_contents,
 
 	  /* We win!  We can handle REPLACE the optimized way.  */
 
+	  /* Keep only the matching text that decoding the file would
+	     produce from the same bytes.  */
+	  if (CODING_REQUIRE_DECODING (&coding))
+	    for (ptrdiff_t pos = same_at_end; pos < ZV_BYTE; pos++)
+	      {
+		pos += unchanged_by_decoding (&coding, pos, ZV_BYTE);
+		if (pos < ZV_BYTE)
+		  same_at_end = pos + 1;
+	      }
+
 	  /* Extend the start of non-matching text area to multibyte
              character boundary.  */
 	  if (! NILP (BVAR (current_buffer, enable_multibyte_characters)))
@@ -5190,6 +5282,10 @@ DEFUN ("insert-file-contents", Finsert_file_contents, Sinsert_file_contents,
     invalidate_region_cache (current_buffer,
                              current_buffer->newline_cache,
                              PT - BEG, Z - PT - inserted);
+  if (current_buffer->base_buffer && current_buffer->base_buffer->line_index)
+    invalidate_line_index (current_buffer->base_buffer, PT, PT + inserted);
+  else if (current_buffer->line_index)
+    invalidate_line_index (current_buffer, PT, PT + inserted);
 
   if (read_quit)
     quit ();
@@ -5932,10 +6028,52 @@ e_write (int desc, Lisp_Object string, ptrdiff_t start, ptrdiff_t end,
 	  ptrdiff_t end_byte = CHAR_TO_BYTE (end);
 
 	  coding->src_multibyte = (end - start) < (end_byte - start_byte);
-	  if (CODING_REQUIRE_ENCODING (coding))
+
+	  /* Write the text that encoding would not change as is, up to
+	     the gap.  */
+	  ptrdiff_t stop_byte = (start < GPT && GPT < end
+				 ? GPT_BYTE : end_byte);
+	  ptrdiff_t unchanged
+	    = (coding->src_multibyte
+	       ? encode_coding_unchanged_bytes (coding,
+						BYTE_POS_ADDR (start_byte),
+						stop_byte - start_byte)
+	       : -1);
+	  /* Otherwise encode the text one byte per character if the
+	     coding system allows it.  */
+	  ptrdiff_t single
+	    = (coding->src_multibyte && unchanged < 0
+	       ? encode_coding_single_bytes (coding, start_byte, stop_byte,
+					     E_WRITE_MAX)
+	       : -1);
+
+	  if (0 < unchanged)
+	    {
+	      coding->dst_object = Qnil;
+	      coding->dst_pos_byte = start_byte;
+	      coding->consumed_char
+		= BYTE_TO_CHAR (start_byte + unchanged) - start;
+	      coding->produced = unchanged;
+	    }
+	  else if (0 < single)
+	    /* The encoded text is in coding->destination.  */
+	    ;
+	  else if (CODING_REQUIRE_ENCODING (coding))
 	    {
 	      ptrdiff_t nchars = min (end - start, E_WRITE_MAX);
 
+	      /* If raw bytes are what keeps the text from being written
+		 as is, encode just them.  Each is two bytes long in the
+		 buffer, starting with 0xC0 or 0xC1.  */
+	      if (unchanged == 0)
+		{
+		  ptrdiff_t nraw = 1;
+		  while (nraw < nchars
+			 && (FETCH_BYTE (start_byte + 2 * nraw) & 0xFE) == 0xC0)
+		    nraw++;
+		  nchars = nraw;
+		}
+
 	      /* Likewise.  */
 	      if (nchars == E_WRITE_MAX)
 		coding->raw_destination = 1;
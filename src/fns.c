@@ -2643,7 +2643,10 @@ DEFUN ("plist-put", Fplist_put, Splist_put, 3, 4, 0,
   (Lisp_Object plist, Lisp_Object prop, Lisp_Object val, Lisp_Object predicate)
 {
   if (NILP (predicate))
-    return plist_put (plist, prop, val);
+    {
+      keymap_modiff++;
+      return plist_put (plist, prop, val);
+    }
   Lisp_Object prev = Qnil, tail = plist;
   FOR_EACH_TAIL (tail)
     {
@@ -2668,7 +2671,10 @@ DEFUN ("plist-put", Fplist_put, Splist_put, 3, 4, 0,
   return plist;
 }
 
-/* Faster version of Fplist_put that works with EQ only.  */
+/* Faster version of Fplist_put that works with EQ only.  Unlike
+   Fplist_put, this doesn't flush the keymap caches: its callers in C
+   modify the property lists of symbols, processes and the like, which
+   are not parts of keymaps.  */
 Lisp_Object
 plist_put (Lisp_Object plist, Lisp_Object prop, Lisp_Object val)
 {
@@ -2680,7 +2686,8 @@ plist_put (Lisp_Object plist, Lisp_Object prop, Lisp_Object val)
 
       if (EQ (XCAR (tail), prop))
 	{
-	  Fsetcar (XCDR (tail), val);
+	  CHECK_IMPURE (XCDR (tail), XCONS (XCDR (tail)));
+	  XSETCAR (XCDR (tail), val);
 	  return plist;
 	}
 
@@ -2692,7 +2699,8 @@ plist_put (Lisp_Object plist, Lisp_Object prop, Lisp_Object val)
     = Fcons (prop, Fcons (val, NILP (prev) ? plist : XCDR (XCDR (prev))));
   if (NILP (prev))
     return newcell;
-  Fsetcdr (XCDR (prev), newcell);
+  CHECK_IMPURE (XCDR (prev), XCONS (XCDR (prev)));
+  XSETCDR (XCDR (prev), newcell);
   return plist;
 }
 
@@ -3247,6 +3255,7 @@ DEFUN ("fillarray", Ffillarray, Sfillarray, 2, 2, 0,
       for (i = 0; i < (1 << CHARTAB_SIZE_BITS_0); i++)
 	set_char_table_contents (array, i, item);
       set_char_table_defalt (array, item);
+      keymap_modiff++;
     }
   else if (STRINGP (array))
     {
@@ -4802,6 +4811,16 @@ hashfn_user_defined (Lisp_Object key, struct Lisp_Hash_Table *h)
   hashtest_equal = { .name = LISPSYM_INITIALLY (Qequal),
 		     .cmpfn = cmpfn_equal, .hashfn = hashfn_equal };
 
+/* Return true if looking up KEY in table H only needs to compare it
+   with 'eq': always for 'eq' tables, and for 'eql' tables unless KEY
+   is a float or bignum.  */
+static bool
+hash_lookup_by_eq_p (struct Lisp_Hash_Table *h, Lisp_Object key)
+{
+  return (!h->test->cmpfn
+	  || (h->test == &hashtest_eql && !FLOATP (key) && !BIGNUMP (key)));
+}
+
 /* Allocate basically initialized hash table.  */
 
 static struct Lisp_Hash_Table *
@@ -4810,14 +4829,20 @@ allocate_hash_table (void)
   return ALLOCATE_PLAIN_PSEUDOVECTOR (struct Lisp_Hash_Table, PVEC_HASH_TABLE);
 }
 
+/* An upper bound on the size of a hash table index.  */
+static ptrdiff_t
+hash_index_size_limit (void)
+{
+  return min (MOST_POSITIVE_FIXNUM,
+	      min (TYPE_MAXIMUM (hash_idx_t),
+		   PTRDIFF_MAX / sizeof (hash_idx_t)));
+}
+
 /* Compute the size of the index (as log2) from the table capacity.  */
 static int
-compute_hash_index_bits (hash_idx_t size)
+compute_hash_index_bits (ptrdiff_t size)
 {
-  /* An upper bound on the size of a hash table index index.  */
-  hash_idx_t upper_bound = min (MOST_POSITIVE_FIXNUM,
-				min (TYPE_MAXIMUM (hash_idx_t),
-				     PTRDIFF_MAX / sizeof (hash_idx_t)));
+  ptrdiff_t upper_bound = hash_index_size_limit ();
   /* Use next higher power of 2.  This works even for size=0.  */
   int bits = elogb (size) + 1;
   if (bits >= TYPE_WIDTH (uintmax_t) || ((uintmax_t)1 << bits) > upper_bound)
@@ -4938,6 +4963,78 @@ hash_index_index (struct Lisp_Hash_Table *h, hash_hash_t hash)
   return knuth_hash (hash, h->index_bits);
 }
 
+/* Resize hash table H so that it has room for NEW_SIZE entries, which
+   must exceed its current size.  If H cannot be resized because it
+   would be too large, throw an error.  */
+
+static void
+hash_table_resize (struct Lisp_Hash_Table *h, ptrdiff_t new_size)
+{
+  ptrdiff_t old_size = HASH_TABLE_SIZE (h);
+  eassert (old_size < new_size);
+  ptrdiff_t index_bits = compute_hash_index_bits (new_size);
+  ptrdiff_t index_size = (ptrdiff_t)1 << index_bits;
+
+  /* Allocate all the new vectors before updating *H, to
+     avoid problems if memory is exhausted.  */
+  hash_idx_t *next = hash_table_alloc_bytes (new_size * sizeof *next);
+  /* Entries freed by remhash keep their place in the free list; the
+     new entries go in front of them.  */
+  memcpy (next, h->next, old_size * sizeof *next);
+  for (ptrdiff_t i = old_size; i < new_size - 1; i++)
+    next[i] = i + 1;
+  next[new_size - 1] = h->next_free;
+
+  Lisp_Object *key_and_value
+    = hash_table_alloc_bytes (2 * new_size * sizeof *key_and_value);
+  memcpy (key_and_value, h->key_and_value,
+	  2 * old_size * sizeof *key_and_value);
+  for (ptrdiff_t i = 2 * old_size; i < 2 * new_size; i++)
+    key_and_value[i] = HASH_UNUSED_ENTRY_KEY;
+
+  hash_hash_t *hash = hash_table_alloc_bytes (new_size * sizeof *hash);
+  memcpy (hash, h->hash, old_size * sizeof *hash);
+
+  ptrdiff_t old_index_size = hash_table_index_size (h);
+  hash_idx_t *index = hash_table_alloc_bytes (index_size * sizeof *index);
+  for (ptrdiff_t i = 0; i < index_size; i++)
+    index[i] = -1;
+
+  h->index_bits = index_bits;
+  h->table_size = new_size;
+  h->next_free = old_size;
+
+  if (old_index_size > 1)
+    hash_table_free_bytes (h->index, old_index_size * sizeof *h->index);
+  h->index = index;
+
+  hash_table_free_bytes (h->key_and_value,
+			 2 * old_size * sizeof *h->key_and_value);
+  h->key_and_value = key_and_value;
+
+  hash_table_free_bytes (h->hash, old_size * sizeof *h->hash);
+  h->hash = hash;
+
+  hash_table_free_bytes (h->next, old_size * sizeof *h->next);
+  h->next = next;
+
+  /* Rehash: all data occupy entries 0..old_size-1.  Unused entries
+     there are already in the free list.  */
+  for (ptrdiff_t i = 0; i < old_size; i++)
+    if (!hash_unused_entry_key_p (HASH_KEY (h, i)))
+      {
+	hash_hash_t hash_code = HASH_HASH (h, i);
+	ptrdiff_t start_of_bucket = hash_index_index (h, hash_code);
+	set_hash_next_slot (h, i, HASH_INDEX (h, start_of_bucket));
+	set_hash_index_slot (h, start_of_bucket, i);
+      }
+
+#ifdef ENABLE_CHECKING
+  if (HASH_TABLE_P (Vpurify_flag) && XHASH_TABLE (Vpurify_flag) == h)
+    message ("Growing hash table to: %"pD"d", new_size);
+#endif
+}
+
 /* Resize hash table H if it's too full.  If H cannot be resized
    because it's already too large, throw an error.  */
 
@@ -4954,64 +5051,7 @@ maybe_resize_hash_table (struct Lisp_Hash_Table *h)
 	old_size == 0
 	? min_size
 	: (base_size <= 64 ? base_size * 4 : base_size * 2);
-
-      /* Allocate all the new vectors before updating *H, to
-	 avoid problems if memory is exhausted.  */
-      hash_idx_t *next = hash_table_alloc_bytes (new_size * sizeof *next);
-      for (ptrdiff_t i = old_size; i < new_size - 1; i++)
-	next[i] = i + 1;
-      next[new_size - 1] = -1;
-
-      Lisp_Object *key_and_value
-	= hash_table_alloc_bytes (2 * new_size * sizeof *key_and_value);
-      memcpy (key_and_value, h->key_and_value,
-	      2 * old_size * sizeof *key_and_value);
-      for (ptrdiff_t i = 2 * old_size; i < 2 * new_size; i++)
-        key_and_value[i] = HASH_UNUSED_ENTRY_KEY;
-
-      hash_hash_t *hash = hash_table_alloc_bytes (new_size * sizeof *hash);
-      memcpy (hash, h->hash, old_size * sizeof *hash);
-
-      ptrdiff_t old_index_size = hash_table_index_size (h);
-      ptrdiff_t index_bits = compute_hash_index_bits (new_size);
-      ptrdiff_t index_size = (ptrdiff_t)1 << index_bits;
-      hash_idx_t *index = hash_table_alloc_bytes (index_size * sizeof *index);
-      for (ptrdiff_t i = 0; i < index_size; i++)
-	index[i] = -1;
-
-      h->index_bits = index_bits;
-      h->table_size = new_size;
-      h->next_free = old_size;
-
-      if (old_index_size > 1)
-	hash_table_free_bytes (h->index, old_index_size * sizeof *h->index);
-      h->index = index;
-
-      hash_table_free_bytes (h->key_and_value,
-			     2 * old_size * sizeof *h->key_and_value);
-      h->key_and_value = key_and_value;
-
-      hash_table_free_bytes (h->hash, old_size * sizeof *h->hash);
-      h->hash = hash;
-
-      hash_table_free_bytes (h->next, old_size * sizeof *h->next);
-      h->next = next;
-
-      h->key_and_value = key_and_value;
-
-      /* Rehash: all data occupy entries 0..old_size-1.  */
-      for (ptrdiff_t i = 0; i < old_size; i++)
-	{
-	  hash_hash_t hash_code = HASH_HASH (h, i);
-	  ptrdiff_t start_of_bucket = hash_index_index (h, hash_code);
-	  set_hash_next_slot (h, i, HASH_INDEX (h, start_of_bucket));
-	  set_hash_index_slot (h, start_of_bucket, i);
-	}
-
-#ifdef ENABLE_CHECKING
-      if (HASH_TABLE_P (Vpurify_flag) && XHASH_TABLE (Vpurify_flag) == h)
-	message ("Growing hash table to: %"pD"d", new_size);
-#endif
+      hash_table_resize (h, new_size);
     }
 }
 
@@ -5082,22 +5122,43 @@ hash_lookup_with_hash (struct Lisp_Hash_Table *h,
 		       Lisp_Object key, hash_hash_t hash)
 {
   ptrdiff_t start_of_bucket = hash_index_index (h, hash);
-  for (ptrdiff_t i = HASH_INDEX (h, start_of_bucket);
-       0 <= i; i = HASH_NEXT (h, i))
+  ptrdiff_t i = HASH_INDEX (h, start_of_bucket);
+  if (hash_lookup_by_eq_p (h, key))
+    {
+      /* Only identical keys can match, so there is no need to look at
+	 the stored hash codes or to call the comparison function.  */
+      while (0 <= i && !EQ (key, HASH_KEY (h, i)))
+	i = HASH_NEXT (h, i);
+      return i;
+    }
+
+  for (; 0 <= i; i = HASH_NEXT (h, i))
     if (EQ (key, HASH_KEY (h, i))
-	|| (h->test->cmpfn
-	    && hash == HASH_HASH (h, i)
+	|| (hash == HASH_HASH (h, i)
 	    && !NILP (h->test->cmpfn (key, HASH_KEY (h, i), h))))
       return i;
 
   return -1;
 }
 
+/* Return a hash code for KEY in table H, computing it directly rather
+   than through H's hash function for the common 'eq' and 'eql'
+   tests.  */
+static hash_hash_t
+hash_from_key_fast (struct Lisp_Hash_Table *h, Lisp_Object key)
+{
+  if (h->test == &hashtest_eq)
+    return hashfn_eq (key, h);
+  if (h->test == &hashtest_eql)
+    return hashfn_eql (key, h);
+  return hash_from_key (h, key);
+}
+
 /* Look up KEY in table H.  Return entry index or -1 if none.  */
 ptrdiff_t
 hash_lookup (struct Lisp_Hash_Table *h, Lisp_Object key)
 {
-  return hash_lookup_with_hash (h, key, hash_from_key (h, key));
+  return hash_lookup_with_hash (h, key, hash_from_key_fast (h, key));
 }
 
 /* Look up KEY in hash table H.  Return its hash value in *PHASH.
@@ -5106,7 +5167,7 @@ hash_lookup (struct Lisp_Hash_Table *h, Lisp_Object key)
 hash_lookup_get_hash (struct Lisp_Hash_Table *h, Lisp_Object key,
 		      hash_hash_t *phash)
 {
-  EMACS_UINT hash = hash_from_key (h, key);
+  EMACS_UINT hash = hash_from_key_fast (h, key);
   *phash = hash;
   return hash_lookup_with_hash (h, key, hash);
 }
@@ -5908,6 +5969,30 @@ DEFUN ("clrhash", Fclrhash, Sclrhash, 1, 1, 0,
 }
 
 
+DEFUN ("hash-table-reserve", Fhash_table_reserve, Shash_table_reserve,
+       2, 2, 0,
+       doc: /* Make room in TABLE for at least SIZE entries and return TABLE.
+Adding entries to TABLE will not make it grow until it holds SIZE
+entries.  Calling this before filling a table from data whose length is
+known avoids the cost of growing it step by step.  This never makes
+TABLE smaller.  */)
+  (Lisp_Object table, Lisp_Object size)
+{
+  struct Lisp_Hash_Table *h = check_hash_table (table);
+  CHECK_FIXNAT (size);
+  if (XFIXNAT (size) > HASH_TABLE_SIZE (h))
+    {
+      check_mutable_hash_table (table, h);
+      /* The table size and the index are made of hash_idx_t.  */
+      if (XFIXNAT (size) >= hash_index_size_limit ()
+	  || XFIXNAT (size) > PTRDIFF_MAX / (2 * sizeof *h->key_and_value))
+	error ("Hash table too large");
+      hash_table_resize (h, XFIXNAT (size));
+    }
+  return table;
+}
+
+
 DEFUN ("gethash", Fgethash, Sgethash, 2, 3, 0,
        doc: /* Look up KEY in TABLE and return its associated value.
 If KEY is not found, return DFLT which defaults to nil.  */)
@@ -6733,6 +6818,7 @@ syms_of_fns (void)
   defsubr (&Shash_table_weakness);
   defsubr (&Shash_table_p);
   defsubr (&Sclrhash);
+  defsubr (&Shash_table_reserve);
   defsubr (&Sgethash);
   defsubr (&Sputhash);
   defsubr (&Sremhash);
@@ -1471,11 +1471,21 @@ replace_range (ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
     outgoing_insbytes
       = count_size_as_multibyte (SDATA (new), insbytes);
 
+  /* If the new text is just as long as the old, overwrite the old
+     text, as subst-char-in-region does, instead of moving the gap,
+     which is expensive if the gap is far away.  */
+  bool in_place = (inschars == nchars_del
+		   && outgoing_insbytes == nbytes_del
+		   && (to <= GPT || GPT <= from));
+
   /* Make sure the gap is somewhere in or next to what we are deleting.  */
-  if (from > GPT)
-    gap_right (from, from_byte);
-  if (to < GPT)
-    gap_left (to, to_byte, 0);
+  if (!in_place)
+    {
+      if (from > GPT)
+	gap_right (from, from_byte);
+      if (to < GPT)
+	gap_left (to, to_byte, 0);
+    }
 
   /* Even if we don't record for undo, we must keep the original text
      because we may have to recover it because of inappropriate byte
@@ -1483,41 +1493,57 @@ replace_range (ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
   if (! EQ (BVAR (current_buffer, undo_list), Qt))
     deletion = make_buffer_string_both (from, from_byte, to, to_byte, 1);
 
-  GAP_SIZE += nbytes_del;
-  ZV -= nchars_del;
-  Z -= nchars_del;
-  ZV_BYTE -= nbytes_del;
-  Z_BYTE -= nbytes_del;
-  GPT = from;
-  GPT_BYTE = from_byte;
-  if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
-
-  eassert (GPT <= GPT_BYTE);
-
-  if (GPT - BEG < BEG_UNCHANGED)
-    BEG_UNCHANGED = GPT - BEG;
-  if (Z - GPT < END_UNCHANGED)
-    END_UNCHANGED = Z - GPT;
-
-  if (GAP_SIZE < outgoing_insbytes)
-    make_gap (outgoing_insbytes - GAP_SIZE);
-
-  /* Copy the string text into the buffer, perhaps converting
-     between single-byte and multibyte.  */
-  copy_text (SDATA (new), GPT_ADDR, insbytes,
-	     STRING_MULTIBYTE (new),
-	     ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
+  if (in_place)
+    {
+      if (from - BEG < BEG_UNCHANGED)
+	BEG_UNCHANGED = from - BEG;
+      if (Z - to < END_UNCHANGED)
+	END_UNCHANGED = Z - to;
+
+      copy_text (SDATA (new), BYTE_POS_ADDR (from_byte), insbytes,
+		 STRING_MULTIBYTE (new),
+		 ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
+    }
+  else
+    {
+      GAP_SIZE += nbytes_del;
+      ZV -= nchars_del;
+      Z -= nchars_del;
+      ZV_BYTE -= nbytes_del;
+      Z_BYTE -= nbytes_del;
+      GPT = from;
+      GPT_BYTE = from_byte;
+      if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
+
+      eassert (GPT <= GPT_BYTE);
+
+      if (GPT - BEG < BEG_UNCHANGED)
+	BEG_UNCHANGED = GPT - BEG;
+      if (Z - GPT < END_UNCHANGED)
+	END_UNCHANGED = Z - GPT;
+
+      if (GAP_SIZE < outgoing_insbytes)
+	make_gap (outgoing_insbytes - GAP_SIZE);
+
+      /* Copy the string text into the buffer, perhaps converting
+	 between single-byte and multibyte.  */
+      copy_text (SDATA (new), GPT_ADDR, insbytes,
+		 STRING_MULTIBYTE (new),
+		 ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
 
 #ifdef BYTE_COMBINING_DEBUG
-  /* We have copied text into the gap, but we have not marked
-     it as part of the buffer.  So we can use the old FROM and FROM_BYTE
-     here, for both the previous text and the following text.
-     Meanwhile, GPT_ADDR does point to
-     the text that has been stored by copy_text.  */
-  if (count_combining_before (GPT_ADDR, outgoing_insbytes, from, from_byte)
-      || count_combining_after (GPT_ADDR, outgoing_insbytes, from, from_byte))
-    emacs_abort ();
+      /* We have copied text into the gap, but we have not marked
+	 it as part of the buffer.  So we can use the old FROM and
+	 FROM_BYTE here, for both the previous text and the following
+	 text.  Meanwhile, GPT_ADDR does point to the text that has
+	 been stored by copy_text.  */
+      if (count_combining_before (GPT_ADDR, outgoing_insbytes, from,
+				  from_byte)
+	  || count_combining_after (GPT_ADDR, outgoing_insbytes, from,
+				    from_byte))
+	emacs_abort ();
 #endif
+    }
 
   /* Record the insertion first, so that when we undo,
      the deletion will be undone first.  Thus, undo
@@ -1529,16 +1555,19 @@ replace_range (ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
       record_delete (from, deletion, false);
     }
 
-  GAP_SIZE -= outgoing_insbytes;
-  GPT += inschars;
-  ZV += inschars;
-  Z += inschars;
-  GPT_BYTE += outgoing_insbytes;
-  ZV_BYTE += outgoing_insbytes;
-  Z_BYTE += outgoing_insbytes;
-  if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
-
-  eassert (GPT <= GPT_BYTE);
+  if (!in_place)
+    {
+      GAP_SIZE -= outgoing_insbytes;
+      GPT += inschars;
+      ZV += inschars;
+      Z += inschars;
+      GPT_BYTE += outgoing_insbytes;
+      ZV_BYTE += outgoing_insbytes;
+      Z_BYTE += outgoing_insbytes;
+      if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
+
+      eassert (GPT <= GPT_BYTE);
+    }
 
   /* Adjust markers for the deletion and the insertion.  */
   if (markers)
@@ -1586,8 +1615,8 @@ replace_range (ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
 
   if (!inhibit_mod_hooks)
     {
-      signal_after_change (from, nchars_del, GPT - from);
-      update_compositions (from, GPT, CHECK_BORDER);
+      signal_after_change (from, nchars_del, inschars);
+      update_compositions (from, from + inschars, CHECK_BORDER);
     }
 }
 
@@ -2136,6 +2165,8 @@ invalidate_buffer_caches (struct buffer *buf, ptrdiff_t start, ptrdiff_t end)
     invalidate_region_cache (buf,
                              buf->width_run_cache,
                              start - BUF_BEG (buf), BUF_Z (buf) - end);
+  if (buf->line_index)
+    invalidate_line_index (buf, start, end);
 }
 
 /* These macros work with an argument named `preserve_ptr'
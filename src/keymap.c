@@ -54,6 +54,7 @@
 #include "intervals.h"
 #include "keymap.h"
 #include "window.h"
+#include "pdumper.h"
 
 /* Actually allocate storage for these variables.  */
 
@@ -68,10 +69,33 @@
 /* Char table for the backwards-compatibility part in Flookup_key.  */
 static Lisp_Object unicode_case_table;
 
-/* Hash table used to cache a reverse-map to speed up calls to where-is.  */
+/* Hash table used to cache reverse-maps to speed up calls to where-is,
+   or nil.  It maps each keymap to a vector of 4 elements, one for each
+   combination of the NOINDIRECT and NOMENUS arguments of
+   where_is_internal.  Each element is nil, or a hash table that maps
+   the bindings in the keymap and its prefix keymaps to the key
+   sequences that reach them, or t if the bindings were computed by a
+   menu item filter and can't be cached, or 0 if the keymap was
+   searched once but its reverse-map not built yet.  The next four
+   elements list the vectors found in the keymaps, each with a copy
+   of its contents, since 'aset' on a vector doesn't change
+   keymap_modiff.  The cache is flushed whenever keymap_modiff
+   changes.  */
 static Lisp_Object where_is_cache;
-/* Which keymaps are reverse-stored in the cache.  */
-static Lisp_Object where_is_cache_keymaps;
+/* The value of keymap_modiff when where_is_cache was made.  */
+static EMACS_UINT where_is_cache_modiff;
+
+/* Vector caching the values recently returned by access_keymap.  Each
+   entry is KEYMAP_CACHE_SLOTS consecutive elements: the keymap, the
+   event, a stamp combining the flags of the lookup with the value of
+   keymap_modiff it was made at, and the binding found.  An entry is
+   only valid while keymap_modiff has not changed since.  */
+static Lisp_Object keymap_cache;
+enum { KEYMAP_CACHE_BITS = 8, KEYMAP_CACHE_SLOTS = 4 };
+
+/* Set by access_keymap_1 when the binding it returns depends on more
+   than the keymap and event, and must not be cached.  */
+static bool keymap_lookup_uncacheable;
 
 static Lisp_Object store_in_keymap (Lisp_Object, Lisp_Object, Lisp_Object,
 				    bool);
@@ -278,8 +302,7 @@ DEFUN ("set-keymap-parent", Fset_keymap_parent, Sset_keymap_parent, 2, 2, 0,
 Return PARENT.  PARENT should be nil or another keymap.  */)
   (Lisp_Object keymap, Lisp_Object parent)
 {
-  /* Flush any reverse-map cache.  */
-  where_is_cache = Qnil; where_is_cache_keymaps = Qt;
+  keymap_modiff++;
 
   keymap = get_keymap (keymap, 1, 1);
 
@@ -405,6 +428,7 @@ access_keymap_1 (Lisp_Object map, Lisp_Object idx,
 				0, autoload);
 		if (KEYMAPP (parent_entry))
 		  {
+		    keymap_lookup_uncacheable = true;
 		    if (CONSP (retval_tail))
 		      XSETCDR (retval_tail, parent_entry);
 		    else
@@ -435,7 +459,11 @@ access_keymap_1 (Lisp_Object map, Lisp_Object idx,
 	else if (VECTORP (binding))
 	  {
 	    if (FIXNUMP (idx) && XFIXNAT (idx) < ASIZE (binding))
-	      val = AREF (binding, XFIXNAT (idx));
+	      {
+		/* 'aset' on a vector does not increment keymap_modiff.  */
+		keymap_lookup_uncacheable = true;
+		val = AREF (binding, XFIXNAT (idx));
+	      }
 	  }
 	else if (CHAR_TABLE_P (binding))
 	  {
@@ -480,6 +508,7 @@ access_keymap_1 (Lisp_Object map, Lisp_Object idx,
 	      }
 	    else
 	      {
+		keymap_lookup_uncacheable = true;
 		retval_tail = list1 (val);
 		retval = Fcons (Qkeymap, Fcons (retval, retval_tail));
 	      }
@@ -496,8 +525,49 @@ access_keymap_1 (Lisp_Object map, Lisp_Object idx,
 access_keymap (Lisp_Object map, Lisp_Object idx,
 	       bool t_ok, bool noinherit, bool autoload)
 {
+  /* Look in the cache first, unless the lookup would depend on
+     `meta-prefix-char'.  */
+  Lisp_Object event = EVENT_HEAD (idx);
+  if (!CONSP (map)
+      || !(SYMBOLP (event)
+	   || (FIXNUMP (event) && !(XFIXNUM (event) & meta_modifier))))
+    {
+      Lisp_Object val = access_keymap_1 (map, idx, t_ok, noinherit,
+					 autoload);
+      return BASE_EQ (val, Qunbound) ? Qnil : val;
+    }
+
+  hash_hash_t hash
+    = reduce_emacs_uint_to_hash_hash (sxhash_combine (XHASH (map),
+						      XHASH (event)));
+  ptrdiff_t i = knuth_hash (hash, KEYMAP_CACHE_BITS) * KEYMAP_CACHE_SLOTS;
+  Lisp_Object stamp = make_ufixnum (((keymap_modiff << 3)
+				     | (t_ok << 2) | (noinherit << 1)
+				     | autoload)
+				    & INTMASK);
+  if (EQ (AREF (keymap_cache, i), map)
+      && EQ (AREF (keymap_cache, i + 1), event)
+      && BASE_EQ (AREF (keymap_cache, i + 2), stamp))
+    return AREF (keymap_cache, i + 3);
+
+  bool outer_uncacheable = keymap_lookup_uncacheable;
+  keymap_lookup_uncacheable = false;
   Lisp_Object val = access_keymap_1 (map, idx, t_ok, noinherit, autoload);
-  return BASE_EQ (val, Qunbound) ? Qnil : val;
+  if (BASE_EQ (val, Qunbound))
+    val = Qnil;
+  bool uncacheable = keymap_lookup_uncacheable;
+  keymap_lookup_uncacheable |= outer_uncacheable;
+  if (!uncacheable)
+    {
+      /* If the lookup changed anything, such as by autoloading a
+	 keymap, STAMP is already out of date and the entry is never
+	 used.  */
+      ASET (keymap_cache, i, map);
+      ASET (keymap_cache, i + 1, event);
+      ASET (keymap_cache, i + 2, stamp);
+      ASET (keymap_cache, i + 3, val);
+    }
+  return val;
 }
 
 static void
@@ -712,6 +782,7 @@ get_keyelt (Lisp_Object object, bool autoload)
 		    filter = XCAR (XCDR (tem));
 		    filter = list2 (filter, list2 (Qquote, object));
 		    object = menu_item_eval_property (filter);
+		    keymap_lookup_uncacheable = true;
 		    break;
 		  }
 	    }
@@ -735,9 +806,7 @@ get_keyelt (Lisp_Object object, bool autoload)
 store_in_keymap (Lisp_Object keymap, register Lisp_Object idx,
 		 Lisp_Object def, bool remove)
 {
-  /* Flush any reverse-map cache.  */
-  where_is_cache = Qnil;
-  where_is_cache_keymaps = Qt;
+  keymap_modiff++;
 
   if (EQ (idx, Qkeymap))
     error ("`keymap' is reserved for embedded parent maps");
@@ -1995,7 +2064,11 @@ accessible_keymaps_1 (Lisp_Object key, Lisp_Object cmd, Lisp_Object args, void *
   else
     {
       tem = append_key (thisseq, key);
-      nconc2 (tail, list1 (Fcons (tem, cmd)));
+      /* Don't use nconc2 here, as setcdr would flush the keymap
+	 caches.  */
+      while (CONSP (XCDR (tail)))
+	tail = XCDR (tail);
+      XSETCDR (tail, list1 (Fcons (tem, cmd)));
     }
 }
 
@@ -2477,55 +2550,58 @@ shadow_lookup (Lisp_Object keymap, Lisp_Object key, Lisp_Object accept_default,
   Lisp_Object definition, this, last;
   bool last_is_meta, noindirect;
   Lisp_Object sequences;
+  /* The reverse-map being filled, or nil to look only for the
+     bindings of DEFINITION.  */
+  Lisp_Object index;
+  /* The vectors in the keymaps walked to fill INDEX, each consed
+     with a copy of its contents.  */
+  Lisp_Object vectors;
 };
 
-/* This function can't GC, AFAIK.  */
-/* Return the list of bindings found.  This list is ordered "longest
-   to shortest".  It may include bindings that are actually shadowed
-   by others, as well as duplicate bindings and remapping bindings.
-   The list returned is potentially shared with where_is_cache, so
-   be careful not to modify it via side-effects.  */
+/* Add the vectors in MAP and its parents to DATA->vectors.  */
 
-static Lisp_Object
-where_is_internal (Lisp_Object definition, Lisp_Object keymaps,
-		   bool noindirect, bool nomenus)
+static void
+where_is_note_vectors (Lisp_Object map, struct where_is_internal_data *data)
 {
-  Lisp_Object maps = Qnil;
-  struct where_is_internal_data data;
-
-  /* Only important use of caching is for the menubar
-     (i.e. where-is-internal called with (def nil t nil nil)).  */
-  if (nomenus && !noindirect)
+  for (; CONSP (map); map = XCDR (map))
     {
-      /* Check heuristic-consistency of the cache.  */
-      if (NILP (Fequal (keymaps, where_is_cache_keymaps)))
-	where_is_cache = Qnil;
-
-      if (NILP (where_is_cache))
-	{
-	  /* We need to create the cache.  */
-	  where_is_cache = Fmake_hash_table (0, NULL);
-	  where_is_cache_keymaps = Qt;
-	}
-      else
-	/* We can reuse the cache.  */
-	return Fgethash (definition, where_is_cache, Qnil);
+      Lisp_Object binding = XCAR (map);
+      if (VECTORP (binding))
+	data->vectors = Fcons (Fcons (binding, Fcopy_sequence (binding)),
+			       data->vectors);
+      else if (KEYMAPP (binding))
+	where_is_note_vectors (binding, data);
     }
-  else
-    /* Kill the cache so that where_is_internal_1 doesn't think
-       we're filling it up.  */
-    where_is_cache = Qnil;
+  map = get_keymap (map, 0, 0);
+  if (CONSP (map))
+    where_is_note_vectors (map, data);
+}
+
+/* Return true if none of the vectors in VECTORS, as recorded by
+   where_is_note_vectors, has changed since.  */
 
-  Lisp_Object found = keymaps;
-  while (CONSP (found))
+static bool
+where_is_vectors_unchanged (Lisp_Object vectors)
+{
+  for (; CONSP (vectors); vectors = XCDR (vectors))
     {
-      maps =
-	nconc2 (maps,
-		Faccessible_keymaps (get_keymap (XCAR (found), 1, 0), Qnil));
-      found = XCDR (found);
+      Lisp_Object vector = XCAR (XCAR (vectors));
+      Lisp_Object copy = XCDR (XCAR (vectors));
+      for (ptrdiff_t i = 0; i < ASIZE (vector); i++)
+	if (!EQ (AREF (vector, i), AREF (copy, i)))
+	  return false;
     }
+  return true;
+}
 
-  data.sequences = Qnil;
+/* Call where_is_internal_1 on the bindings of KEYMAP and its prefix
+   keymaps, with DATA.  NOMENUS is as for where_is_internal.  */
+
+static void
+where_is_walk (Lisp_Object keymap, struct where_is_internal_data *data,
+	       bool nomenus)
+{
+  Lisp_Object maps = Faccessible_keymaps (keymap, Qnil);
   for (; CONSP (maps); maps = XCDR (maps))
     {
       /* Key sequence to reach map, and the map that it reaches */
@@ -2554,27 +2630,110 @@ where_is_internal (Lisp_Object definition, Lisp_Object keymaps,
 
       maybe_quit ();
 
-      data.definition = definition;
-      data.noindirect = noindirect;
-      data.this = this;
-      data.last = last;
-      data.last_is_meta = last_is_meta;
+      data->this = this;
+      data->last = last;
+      data->last_is_meta = last_is_meta;
 
       if (CONSP (map))
-	map_keymap (map, where_is_internal_1, Qnil, &data, 0);
+	{
+	  map_keymap (map, where_is_internal_1, Qnil, data, 0);
+	  if (!NILP (data->index))
+	    where_is_note_vectors (map, data);
+	}
     }
+}
 
-  if (nomenus && !noindirect)
-    { /* Remember for which keymaps this cache was built.
-	 We do it here (late) because we want to keep where_is_cache_keymaps
-	 set to t while the cache isn't fully filled.  */
-      where_is_cache_keymaps = keymaps;
-      /* During cache-filling, data.sequences is not filled by
-	 where_is_internal_1.  */
-      return Fgethash (definition, where_is_cache, Qnil);
+/* Return the reverse-map of KEYMAP from where_is_cache, building it
+   if necessary, or t if KEYMAP must be searched anew this time.
+   NOINDIRECT and NOMENUS are as for where_is_internal.
+   This function can't GC, AFAIK.  */
+
+static Lisp_Object
+where_is_index (Lisp_Object keymap, bool noindirect, bool nomenus)
+{
+  if (NILP (where_is_cache) || where_is_cache_modiff != keymap_modiff)
+    {
+      where_is_cache = make_hash_table (&hashtest_eq, DEFAULT_HASH_SIZE,
+					Weak_Key, false);
+      where_is_cache_modiff = keymap_modiff;
     }
-  else
-    return data.sequences;
+  Lisp_Object indexes = Fgethash (keymap, where_is_cache, Qnil);
+  if (NILP (indexes))
+    {
+      indexes = make_nil_vector (8);
+      Fputhash (keymap, indexes, where_is_cache);
+    }
+  int i = noindirect << 1 | nomenus;
+  /* Any setcar or setcdr flushes the cache, so Lisp code that runs
+     between two calls may well flush it every time.  Building a
+     reverse-map costs more than one search, so only build it when
+     KEYMAP is searched a second time without a change in between.  */
+  Lisp_Object index = AREF (indexes, i);
+  if (NILP (index))
+    {
+      ASET (indexes, i, make_fixnum (0));
+      return Qt;
+    }
+  if (EQ (index, Qt)
+      || (HASH_TABLE_P (index)
+	  && where_is_vectors_unchanged (AREF (indexes, i + 4))))
+    return index;
+
+  struct where_is_internal_data data;
+  data.definition = Qnil;
+  data.noindirect = noindirect;
+  data.index = make_hash_table (&hashtest_eq, DEFAULT_HASH_SIZE,
+				Weak_None, false);
+  data.vectors = Qnil;
+  bool outer_uncacheable = keymap_lookup_uncacheable;
+  keymap_lookup_uncacheable = false;
+  where_is_walk (keymap, &data, nomenus);
+  ASET (indexes, i, keymap_lookup_uncacheable ? Qt : data.index);
+  ASET (indexes, i + 4, data.vectors);
+  keymap_lookup_uncacheable |= outer_uncacheable;
+  return data.index;
+}
+
+/* This function can't GC, AFAIK.  */
+/* Return the list of bindings found.  This list is ordered "longest
+   to shortest".  It may include bindings that are actually shadowed
+   by others, as well as duplicate bindings and remapping bindings.
+   The list returned is potentially shared with where_is_cache, so
+   be careful not to modify it via side-effects.  */
+
+static Lisp_Object
+where_is_internal (Lisp_Object definition, Lisp_Object keymaps,
+		   bool noindirect, bool nomenus)
+{
+  struct where_is_internal_data data;
+  data.definition = definition;
+  data.noindirect = noindirect;
+  data.index = Qnil;
+  data.vectors = Qnil;
+  data.sequences = Qnil;
+
+  for (; CONSP (keymaps); keymaps = XCDR (keymaps))
+    {
+      Lisp_Object keymap = get_keymap (XCAR (keymaps), 1, 0);
+
+      /* Bindings that are lists match DEFINITION if they are `equal'
+	 to it, so they can't be looked up in the reverse-maps.  */
+      Lisp_Object index = (CONSP (definition) ? Qt
+			   : where_is_index (keymap, noindirect, nomenus));
+      if (EQ (index, Qt))
+	where_is_walk (keymap, &data, nomenus);
+      else
+	{
+	  /* The bindings found in later keymaps go first.  */
+	  Lisp_Object found = Fgethash (definition, index, Qnil);
+	  if (NILP (data.sequences))
+	    data.sequences = found;
+	  else if (!NILP (found))
+	    data.sequences = CALLN (Fappend, found, data.sequences);
+	}
+    }
+
+  return data.sequences;
 }
 
 /* This function can GC if Flookup_key autoloads any keymaps.  */
@@ -2618,7 +2777,7 @@ DEFUN ("where-is-internal", Fwhere_is_internal, Swhere_is_internal, 1, 5, 0,
   /* Potentially relevant bindings in "shortest to longest" order.  */
   Lisp_Object sequences = Qnil;
     /* Actually relevant bindings.  */
-  Lisp_Object found = Qnil;
+  Lisp_Object found = Qnil, found_tail = Qnil;
   /* 1 means ignore all menu bindings entirely.  */
   bool nomenus = !NILP (firstonly) && !EQ (firstonly, Qnon_ascii);
   /* List of sequences found via remapping.  Keep them in a separate
@@ -2715,7 +2874,8 @@ DEFUN ("where-is-internal", Fwhere_is_internal, Swhere_is_internal, 1, 5, 0,
 	{
 	  Lisp_Object seqs = where_is_internal (function, keymaps,
 						!NILP (noindirect), nomenus);
-	  remapped_sequences = nconc2 (Freverse (seqs), remapped_sequences);
+	  for (; CONSP (seqs); seqs = XCDR (seqs))
+	    remapped_sequences = Fcons (XCAR (seqs), remapped_sequences);
 	  continue;
 	}
 
@@ -2728,8 +2888,12 @@ DEFUN ("where-is-internal", Fwhere_is_internal, Swhere_is_internal, 1, 5, 0,
 	  Lisp_Object tem1;
 	  tem1 = Faref (sequence, make_fixnum (ASIZE (sequence) - 1));
 	  if (STRINGP (tem1))
-	    Faset (sequence, make_fixnum (ASIZE (sequence) - 1),
-		   build_string ("(any string)"));
+	    {
+	      /* SEQUENCE may be shared with where_is_cache.  */
+	      sequence = Fcopy_sequence (sequence);
+	      Faset (sequence, make_fixnum (ASIZE (sequence) - 1),
+		     build_string ("(any string)"));
+	    }
 	}
 
       /* It is a true unshadowed match.  Record it, unless it's already
@@ -2740,7 +2904,16 @@ DEFUN ("where-is-internal", Fwhere_is_internal, Swhere_is_internal, 1, 5, 0,
 	       && ASIZE (sequence) == 1
 	       && SYMBOLP (AREF (sequence, 0))
 	       && !NILP (Fget (AREF (sequence, 0), Qnon_key_event))))
-	found = Fcons (sequence, found);
+	{
+	  /* Append with XSETCDR rather than reversing the list at the
+	     end, since Fsetcdr would flush the cache of access_keymap.  */
+	  Lisp_Object cell = list1 (sequence);
+	  if (NILP (found))
+	    found = cell;
+	  else
+	    XSETCDR (found_tail, cell);
+	  found_tail = cell;
+	}
 
       /* If firstonly is Qnon_ascii, then we can return the first
 	 binding we find.  If firstonly is not Qnon_ascii but not
@@ -2753,8 +2926,6 @@ DEFUN ("where-is-internal", Fwhere_is_internal, Swhere_is_internal, 1, 5, 0,
 	return sequence;
     }
 
-  found = Fnreverse (found);
-
   /* firstonly may have been t, but we may have gone all the way through
      the keymaps without finding an all-ASCII key sequence.  So just
      return the best we could find.  */
@@ -2795,7 +2966,7 @@ where_is_internal_1 (Lisp_Object key, Lisp_Object binding, Lisp_Object args, voi
   /* End this iteration if this element does not match
      the target.  */
 
-  if (!(!NILP (where_is_cache)	/* everything "matches" during cache-fill.  */
+  if (!(!NILP (d->index)	/* everything "matches" during cache-fill.  */
 	|| EQ (binding, definition)
 	|| (CONSP (definition) && !NILP (Fequal (binding, definition)))))
     /* Doesn't match.  */
@@ -2814,10 +2985,10 @@ where_is_internal_1 (Lisp_Object key, Lisp_Object binding, Lisp_Object args, voi
       sequence = append_key (this, key);
     }
 
-  if (!NILP (where_is_cache))
+  if (!NILP (d->index))
     {
-      Lisp_Object sequences = Fgethash (binding, where_is_cache, Qnil);
-      Fputhash (binding, Fcons (sequence, sequences), where_is_cache);
+      Lisp_Object sequences = Fgethash (binding, d->index, Qnil);
+      Fputhash (binding, Fcons (sequence, sequences), d->index);
     }
   else
     d->sequences = Fcons (sequence, d->sequences);
@@ -3443,10 +3614,12 @@ syms_of_keymap (void)
   command_remapping_vector = make_vector (2, Qremap);
   staticpro (&command_remapping_vector);
 
-  where_is_cache_keymaps = Qt;
   where_is_cache = Qnil;
   staticpro (&where_is_cache);
-  staticpro (&where_is_cache_keymaps);
+
+  keymap_cache = make_nil_vector (KEYMAP_CACHE_SLOTS << KEYMAP_CACHE_BITS);
+  staticpro (&keymap_cache);
+  PDUMPER_REMEMBER_SCALAR (keymap_modiff);
 
   DEFSYM (Qfont_lock_face, "font-lock-face");
   DEFSYM (Qhelp_key_binding, "help-key-binding");
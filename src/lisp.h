@@ -4217,6 +4217,7 @@ modiff_to_integer (modiff_count a)
 }
 
 /* Defined in data.c.  */
+extern EMACS_UINT keymap_modiff;
 extern AVOID wrong_choice (Lisp_Object, Lisp_Object);
 extern void notify_variable_watchers (Lisp_Object, Lisp_Object,
 				      Lisp_Object, Lisp_Object);
@@ -4532,7 +4533,7 @@ flush_stack_call_func (void (*func) (void *arg), void *arg)
 
 extern void garbage_collect (void);
 extern void maybe_garbage_collect (void);
-extern bool maybe_garbage_collect_eagerly (EMACS_INT factor);
+extern void maybe_garbage_collect_when_idle (void);
 extern const char *pending_malloc_warning;
 extern Lisp_Object zero_vector;
 extern EMACS_INT consing_until_gc;
@@ -5100,6 +5101,12 @@ fast_c_string_match_ignore_case (Lisp_Object regexp,
 
 extern ptrdiff_t fast_looking_at (Lisp_Object, ptrdiff_t, ptrdiff_t,
                                   ptrdiff_t, ptrdiff_t, Lisp_Object);
+extern ptrdiff_t bulk_count_newlines (unsigned char const *, ptrdiff_t,
+				      ptrdiff_t *);
+struct line_index;
+extern void free_line_index (struct line_index *);
+extern void invalidate_line_index (struct buffer *, ptrdiff_t, ptrdiff_t);
+extern ptrdiff_t line_index_count_newlines (ptrdiff_t, ptrdiff_t);
 extern ptrdiff_t find_newline1 (ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t,
                                ptrdiff_t, ptrdiff_t *, ptrdiff_t *, bool);
 extern ptrdiff_t find_newline (ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t,
@@ -20,6 +20,7 @@ Copyright (C) 1985-1986, 1993-2024 Free Software Foundation, Inc.
 
 #include <config.h>
 #include <errno.h>
+#include <math.h>
 
 #include <binary-io.h>
 
@@ -1589,6 +1590,30 @@ match_regexps (Lisp_Object string, Lisp_Object regexps,
   return true;
 }
 
+/* Return true if STRING is a prefix of ELTSTRING, ignoring case if
+   IGNORE_CASE.  This is what calling `compare-strings' on the first
+   (length STRING) characters of both would say, but when the bytes
+   of the two strings encode characters the same way, it compares the
+   bytes directly.  */
+static bool
+completion_prefix_p (Lisp_Object string, Lisp_Object eltstring,
+		     bool ignore_case)
+{
+  if (SCHARS (string) > SCHARS (eltstring))
+    return false;
+  if (!ignore_case
+      && (STRING_MULTIBYTE (string) == STRING_MULTIBYTE (eltstring)
+	  || (STRING_MULTIBYTE (string)
+	      && SCHARS (string) == SBYTES (string))))
+    return (SBYTES (string) <= SBYTES (eltstring)
+	    && memcmp (SDATA (string), SDATA (eltstring),
+		       SBYTES (string)) == 0);
+  Lisp_Object zero = make_fixnum (0);
+  return EQ (Fcompare_strings (eltstring, zero, make_fixnum (SCHARS (string)),
+			       string, zero, Qnil, ignore_case ? Qt : Qnil),
+	     Qt);
+}
+
 DEFUN ("try-completion", Ftry_completion, Stry_completion, 2, 3, 0,
        doc: /* Return longest common substring of all completions of STRING in COLLECTION.
 
@@ -1704,12 +1729,7 @@ DEFUN ("try-completion", Ftry_completion, Stry_completion, 2, 3, 0,
 	eltstring = Fsymbol_name (eltstring);
 
       if (STRINGP (eltstring)
-	  && SCHARS (string) <= SCHARS (eltstring)
-	  && (tem = Fcompare_strings (eltstring, zero,
-				      make_fixnum (SCHARS (string)),
-				      string, zero, Qnil,
-				      completion_ignore_case ? Qt : Qnil),
-	      EQ (Qt, tem)))
+	  && completion_prefix_p (string, eltstring, completion_ignore_case))
 	{
 	  /* Ignore this element if it fails to match all the regexps.  */
 	  if (!match_regexps (eltstring, Vcompletion_regexp_list,
@@ -1877,13 +1897,12 @@ DEFUN ("all-completions", Fall_completions, Sall_completions, 2, 4, 0,
 				 && !FUNCTIONP (collection)))
 			    ? 1 : 0)));
   ptrdiff_t idx = 0;
-  Lisp_Object bucket, tem, zero;
+  Lisp_Object bucket, tem;
 
   CHECK_STRING (string);
   if (type == 0)
     return call3 (collection, string, predicate, Qt);
   allmatches = bucket = Qnil;
-  zero = make_fixnum (0);
 
   /* If COLLECTION is not a list, set TAIL just for gc pro.  */
   tail = collection;
@@ -1938,12 +1957,7 @@ DEFUN ("all-completions", Fall_completions, Sall_completions, 2, 4, 0,
 	      || (SBYTES (string) > 0
 		  && SREF (string, 0) == ' ')
 	      || SREF (eltstring, 0) != ' ')
-	  && (tem = Fcompare_strings (eltstring, zero,
-				      make_fixnum (SCHARS (string)),
-				      string, zero,
-				      make_fixnum (SCHARS (string)),
-				      completion_ignore_case ? Qt : Qnil),
-	      EQ (Qt, tem)))
+	  && completion_prefix_p (string, eltstring, completion_ignore_case))
 	{
 	  /* Ignore this element if it fails to match all the regexps.  */
 	  if (!match_regexps (eltstring, Vcompletion_regexp_list,
@@ -1975,6 +1989,144 @@ DEFUN ("all-completions", Fall_completions, Sall_completions, 2, 4, 0,
 
   return Fnreverse (allmatches);
 }
+
+/* Match the characters PCHARS[0..NPAT-1] in order against CANDIDATE,
+   each at the earliest position where it can be, which is also where
+   the regexps built by the `flex' completion style match them.  Store
+   the character positions of the matches in POS and return true if
+   all the characters were found.  PCHARS are downcased if IGNORE_CASE.
+   If PBYTES is non-null, PCHARS are all ASCII and PBYTES holds them as
+   bytes; then, unless IGNORE_CASE, they are searched for with memchr,
+   which is much faster than decoding every character of CANDIDATE.  */
+static bool
+flex_match (const int *pchars, const char *pbytes, ptrdiff_t npat,
+	    Lisp_Object candidate, bool ignore_case, ptrdiff_t *pos)
+{
+  ptrdiff_t nchars = SCHARS (candidate), nbytes = SBYTES (candidate);
+  if (nchars < npat)
+    return false;
+
+  if (pbytes && !ignore_case)
+    {
+      unsigned char *beg = SDATA (candidate), *p = beg;
+      bool count_heads = STRING_MULTIBYTE (candidate) && nchars != nbytes;
+      ptrdiff_t charpos = 0;
+      for (ptrdiff_t i = 0; i < npat; i++)
+	{
+	  unsigned char *q = memchr (p, pbytes[i], beg + nbytes - p);
+	  if (!q)
+	    return false;
+	  if (count_heads)
+	    for (; p < q; p++)
+	      charpos += CHAR_HEAD_P (*p);
+	  else
+	    charpos += q - p;
+	  pos[i] = charpos++;
+	  p = q + 1;
+	}
+      return true;
+    }
+
+  ptrdiff_t charpos = 0, bytepos = 0;
+  for (ptrdiff_t i = 0; i < npat; i++)
+    {
+      for (;;)
+	{
+	  if (charpos == nchars || nchars - charpos < npat - i)
+	    return false;
+	  int c = fetch_string_char_as_multibyte_advance (candidate, &charpos,
+							  &bytepos);
+	  if ((ignore_case ? downcase (c) : c) == pchars[i])
+	    break;
+	}
+      pos[i] = charpos - 1;
+    }
+  return true;
+}
+
+DEFUN ("completion-flex-match", Fcompletion_flex_match,
+       Scompletion_flex_match, 2, 4, 0,
+       doc: /* Match PATTERN against each of CANDIDATES as `flex' completion does.
+PATTERN is a string and CANDIDATES is a list of strings.  A candidate
+matches if it contains all the characters of PATTERN in the same order,
+but not necessarily next to each other.
+
+Return a list with one element for each element of CANDIDATES: nil if
+the candidate does not match, and its score otherwise.  The score is a
+number between 0 and 1, computed like `completion--flex-score' does,
+which is larger the fewer and shorter the gaps between the matched
+characters are, and the shorter the candidate is.  The variable
+`flex-score-match-tightness' weighs the length of each gap.
+
+If IGNORE-CASE is non-nil, ignore case when matching.
+
+If POSITIONS is non-nil, each element for a matching candidate is
+instead a list (SCORE START1 END1 START2 END2 ...), where STARTn and
+ENDn delimit the runs of characters that matched PATTERN, such as for
+highlighting them.  */)
+  (Lisp_Object pattern, Lisp_Object candidates, Lisp_Object ignore_case,
+   Lisp_Object positions)
+{
+  CHECK_STRING (pattern);
+  CHECK_LIST (candidates);
+
+  Lisp_Object tightness = find_symbol_value (Qflex_score_match_tightness);
+  double exponent = 1.0 / (NUMBERP (tightness) ? XFLOATINT (tightness) : 3);
+
+  ptrdiff_t npat = SCHARS (pattern);
+  USE_SAFE_ALLOCA;
+  int *pchars;
+  ptrdiff_t *pos;
+  SAFE_NALLOCA (pchars, 1, npat);
+  SAFE_NALLOCA (pos, 1, npat);
+  bool ascii = true;
+  for (ptrdiff_t i = 0, charpos = 0, bytepos = 0; i < npat; i++)
+    {
+      int c = fetch_string_char_as_multibyte_advance (pattern, &charpos,
+						      &bytepos);
+      ascii &= ASCII_CHAR_P (c);
+      pchars[i] = NILP (ignore_case) ? c : downcase (c);
+    }
+  /* A unibyte pattern can have as many bytes as characters without
+     being ASCII, and its bytes >= 0x80 must not be searched for inside
+     the multibyte sequences of a candidate.  */
+  char *pbytes = ascii ? SSDATA (pattern) : NULL;
+
+  Lisp_Object result = Qnil;
+  ptrdiff_t n = 0;
+  FOR_EACH_TAIL (candidates)
+    {
+      Lisp_Object candidate = XCAR (candidates), elt = Qnil;
+      CHECK_STRING (candidate);
+      if (flex_match (pchars, pbytes, npat, candidate, !NILP (ignore_case),
+		      pos))
+	{
+	  ptrdiff_t len = SCHARS (candidate);
+	  double holes = 0;
+	  for (ptrdiff_t i = 1; i < npat; i++)
+	    if (pos[i] - pos[i - 1] > 1)
+	      holes += 1 + pow (pos[i] - pos[i - 1] - 2, exponent);
+	  elt = make_float (len == 0 ? 1 : npat / (len * (1 + holes)));
+	  if (!NILP (positions))
+	    {
+	      Lisp_Object runs = Qnil;
+	      for (ptrdiff_t i = npat; 0 < i; )
+		{
+		  ptrdiff_t end = pos[--i] + 1;
+		  while (0 < i && pos[i - 1] == pos[i] - 1)
+		    i--;
+		  runs = Fcons (make_fixnum (pos[i]),
+				Fcons (make_fixnum (end), runs));
+		}
+	      elt = Fcons (elt, runs);
+	    }
+	}
+      result = Fcons (elt, result);
+      rarely_quit (++n);
+    }
+  SAFE_FREE ();
+  return Fnreverse (result);
+}
 
 DEFUN ("completing-read", Fcompleting_read, Scompleting_read, 2, 8, 0,
        doc: /* Read a string in the minibuffer, with completion.
@@ -2325,6 +2477,7 @@ syms_of_minibuf (void)
   DEFSYM (Qminibuffer_completing_file_name, "minibuffer-completing-file-name");
   DEFSYM (Qselect_frame_set_input_focus, "select-frame-set-input-focus");
   DEFSYM (Qadd_to_history, "add-to-history");
+  DEFSYM (Qflex_score_match_tightness, "flex-score-match-tightness");
   DEFSYM (Qpush_window_buffer_onto_prev, "push-window-buffer-onto-prev");
 
   DEFVAR_LISP ("read-expression-history", Vread_expression_history,
@@ -2539,6 +2692,7 @@ syms_of_minibuf (void)
 
   defsubr (&Stry_completion);
   defsubr (&Sall_completions);
+  defsubr (&Scompletion_flex_match);
   defsubr (&Stest_completion);
   defsubr (&Sassoc_string);
   defsubr (&Scompleting_read);
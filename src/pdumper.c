@@ -2223,6 +2223,8 @@ dump_treesit_compiled_query (struct dump_context *ctx,
   START_DUMP_PVEC (ctx, &query->header, struct Lisp_TS_Query, out);
   dump_field_lv (ctx, &out->language, query, &query->language, WEIGHT_STRONG);
   dump_field_lv (ctx, &out->source, query, &query->source, WEIGHT_STRONG);
+  dump_field_lv (ctx, &out->predicates, query, &query->predicates,
+		 WEIGHT_NORMAL);
   /* These will be recompiled after load from dump.  */
   out->query = NULL;
   out->cursor = NULL;
@@ -2811,7 +2813,7 @@ dump_obarray (struct dump_context *ctx, Lisp_Object object)
 static dump_off
 dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
 {
-#if CHECK_STRUCTS && !defined HASH_buffer_B02F648B82
+#if CHECK_STRUCTS && !defined HASH_buffer_6D30E73D5A
 # error "buffer changed. See CHECK_STRUCTS comment in config.h."
 #endif
   struct buffer munged_buffer = *in_buffer;
@@ -2920,6 +2922,7 @@ dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
   out->newline_cache = NULL;
   out->width_run_cache = NULL;
   out->bidi_paragraph_cache = NULL;
+  out->line_index = NULL;
 
   DUMP_FIELD_COPY (out, buffer, prevent_redisplay_optimizations_p);
   DUMP_FIELD_COPY (out, buffer, clip_changed);
@@ -646,6 +646,345 @@ newline_cache_on_off (struct buffer *buf)
 }
 
 
+/* Return the number of newlines in the N bytes starting at P.
+
+   This is written so that compilers can vectorize the inner loop:
+   each of the byte-sized counters in ACC counts the newlines in one
+   column of a block of WIDTH-byte rows, and is added to the total
+   before it can overflow.  */
+
+static ptrdiff_t
+count_newlines (unsigned char const *p, ptrdiff_t n)
+{
+  enum { WIDTH = 32, BLOCK = UCHAR_MAX * WIDTH };
+  ptrdiff_t count = 0;
+
+  while (n >= WIDTH)
+    {
+      ptrdiff_t m = n < BLOCK ? n - n % WIDTH : BLOCK;
+      unsigned char acc[WIDTH] = {0};
+      for (ptrdiff_t i = 0; i < m; i += WIDTH)
+	for (int j = 0; j < WIDTH; j++)
+	  acc[j] += p[i + j] == '\n';
+      for (int j = 0; j < WIDTH; j++)
+	count += acc[j];
+      p += m;
+      n -= m;
+    }
+
+  for (; 0 < n; n--)
+    count += *p++ == '\n';
+
+  return count;
+}
+
+/* Subroutine of the scanning loops that look for the COUNTth newline
+   forward in the N contiguous bytes at P.  If so many newlines remain
+   to be found that counting them in bulk pays off, count those in the
+   first bytes at P that cannot contain the COUNTth newline, and
+   subtract that from *COUNT.  Examine no more than a megabyte at a
+   time, so that the caller can quit in between.  Return the number of
+   bytes examined, which is zero if the caller should look for the
+   newlines one by one instead.  The return value can be the middle of
+   a multibyte character.  */
+
+ptrdiff_t
+bulk_count_newlines (unsigned char const *p, ptrdiff_t n, ptrdiff_t *count)
+{
+  /* Finding the newlines one by one with memchr is faster unless the
+     count is large enough to let us examine many bytes at once.  */
+  enum { BULK_MIN = 1024, BULK_MAX = 1024 * 1024 };
+
+  n = min (min (n, *count - 1), BULK_MAX);
+  if (n < BULK_MIN)
+    return 0;
+  *count -= count_newlines (p, n);
+  return n;
+}
+
+/* Return the number of newlines between byte positions START_BYTE
+   and END_BYTE of the current buffer.  */
+
+static ptrdiff_t
+count_buffer_newlines (ptrdiff_t start_byte, ptrdiff_t end_byte)
+{
+  ptrdiff_t count = 0;
+
+  if (start_byte < GPT_BYTE)
+    {
+      ptrdiff_t gap_byte = min (end_byte, GPT_BYTE);
+      count += count_newlines (BYTE_POS_ADDR (start_byte),
+			       gap_byte - start_byte);
+      start_byte = gap_byte;
+    }
+  if (start_byte < end_byte)
+    count += count_newlines (BYTE_POS_ADDR (start_byte),
+			     end_byte - start_byte);
+  return count;
+}
+
+
+/* The line index of a buffer divides its text into chunks of about
+   LINE_INDEX_CHUNK bytes, and records the length of each chunk and
+   the number of newlines in it in two Fenwick trees.  This finds the
+   number of newlines before any position in logarithmic time, plus
+   the time to count the newlines in part of one chunk.
+
+   Like the region caches, the index is only told how much text at
+   the beginning and at the end of the buffer modifications left
+   unchanged, and it brings itself up to date when it is next used:
+   it merges the chunks that overlap the changed text into one, and
+   counts the newlines in that chunk anew.  */
+
+enum { LINE_INDEX_CHUNK = 64 * 1024 };
+
+struct line_index
+{
+  /* The number of chunks, and the Fenwick trees, indexed from 1, of
+     their lengths in bytes and of the number of newlines in them.  */
+  ptrdiff_t nchunks;
+  ptrdiff_t *bytes;
+  ptrdiff_t *newlines;
+
+  /* The length of the text in characters and in bytes as of the last
+     time the index was brought up to date.  */
+  ptrdiff_t chars, nbytes;
+
+  /* The number of characters at the beginning and at the end of the
+     text that are known to be unchanged since then.  */
+  ptrdiff_t beg_unchanged, end_unchanged;
+};
+
+/* Add DELTA to element I of the Fenwick tree TREE of N elements.  */
+
+static void
+fenwick_add (ptrdiff_t *tree, ptrdiff_t n, ptrdiff_t i, ptrdiff_t delta)
+{
+  for (; i <= n; i += i & -i)
+    tree[i] += delta;
+}
+
+/* Return the sum of the first I elements of the Fenwick tree TREE.  */
+
+static ptrdiff_t
+fenwick_sum (ptrdiff_t const *tree, ptrdiff_t i)
+{
+  ptrdiff_t sum = 0;
+  for (; 0 < i; i -= i & -i)
+    sum += tree[i];
+  return sum;
+}
+
+/* Return the largest I such that the sum of the first I elements of
+   the Fenwick tree TREE of N nonnegative elements is at most VALUE,
+   and set *SUM to that sum.  */
+
+static ptrdiff_t
+fenwick_search (ptrdiff_t const *tree, ptrdiff_t n, ptrdiff_t value,
+		ptrdiff_t *sum)
+{
+  ptrdiff_t i = 0, step = 1;
+
+  *sum = 0;
+  while (step <= n / 2)
+    step *= 2;
+  for (; 0 < step; step /= 2)
+    if (i + step <= n && *sum + tree[i + step] <= value)
+      {
+	i += step;
+	*sum += tree[i];
+      }
+  return i;
+}
+
+/* Return the chunk of the line index LI that contains the byte at
+   offset OFFSET from the beginning of the text, or the last chunk if
+   OFFSET is the length of the text.  Set *START to the offset of the
+   beginning of that chunk.  */
+
+static ptrdiff_t
+line_index_chunk (struct line_index *li, ptrdiff_t offset, ptrdiff_t *start)
+{
+  ptrdiff_t i = fenwick_search (li->bytes, li->nchunks, offset, start);
+  if (i < li->nchunks)
+    return i + 1;
+  *start = fenwick_sum (li->bytes, li->nchunks - 1);
+  return li->nchunks;
+}
+
+void
+free_line_index (struct line_index *li)
+{
+  xfree (li->bytes);
+  xfree (li->newlines);
+  xfree (li);
+}
+
+/* Return a new line index for the text of the current buffer.  */
+
+static struct line_index *
+make_line_index (void)
+{
+  struct line_index *li = xmalloc (sizeof *li);
+  ptrdiff_t n = (Z_BYTE - BEG_BYTE) / LINE_INDEX_CHUNK + 1;
+  ptrdiff_t pos = BEG_BYTE;
+
+  li->nchunks = n;
+  li->bytes = xnmalloc (n + 1, sizeof *li->bytes);
+  li->newlines = xnmalloc (n + 1, sizeof *li->newlines);
+  li->bytes[0] = li->newlines[0] = 0;
+  for (ptrdiff_t i = 1; i <= n; i++)
+    {
+      ptrdiff_t end = i < n ? pos + LINE_INDEX_CHUNK : Z_BYTE;
+      li->bytes[i] = end - pos;
+      li->newlines[i] = count_buffer_newlines (pos, end);
+      pos = end;
+    }
+
+  /* Turn the arrays into Fenwick trees, in linear time.  */
+  for (ptrdiff_t i = 1; i <= n; i++)
+    {
+      ptrdiff_t parent = i + (i & -i);
+      if (parent <= n)
+	{
+	  li->bytes[parent] += li->bytes[i];
+	  li->newlines[parent] += li->newlines[i];
+	}
+    }
+
+  li->chars = Z - BEG;
+  li->nbytes = Z_BYTE - BEG_BYTE;
+  li->beg_unchanged = li->end_unchanged = li->chars;
+  return li;
+}
+
+/* Bring the line index LI of the current buffer (or of its base
+   buffer) up to date.  Return LI, or a new index that replaces it if
+   merging chunks made the index too unbalanced.  */
+
+static struct line_index *
+revalidate_line_index (struct line_index *li)
+{
+  /* If nothing changed, there is nothing to do; see
+     revalidate_region_cache for why this is a >.  */
+  if (li->beg_unchanged + li->end_unchanged > li->chars)
+    return li;
+
+  ptrdiff_t beg_unchanged = min (li->beg_unchanged, Z - BEG);
+  ptrdiff_t end_unchanged = min (li->end_unchanged, Z - BEG - beg_unchanged);
+
+  /* The offsets of the changed text from the beginning of the text,
+     and of its end before and after the changes.  */
+  ptrdiff_t from = CHAR_TO_BYTE (BEG + beg_unchanged) - BEG_BYTE;
+  ptrdiff_t new_to = CHAR_TO_BYTE (Z - end_unchanged) - BEG_BYTE;
+  ptrdiff_t old_to = li->nbytes - (Z_BYTE - BEG_BYTE - new_to);
+
+  /* Merge the chunks that overlap the changed text into the first.  */
+  ptrdiff_t start, ignored;
+  ptrdiff_t first = line_index_chunk (li, from, &start);
+  ptrdiff_t last = (old_to <= from ? first
+		    : line_index_chunk (li, old_to - 1, &ignored));
+  ptrdiff_t length = fenwick_sum (li->bytes, last) - start + new_to - old_to;
+
+  for (ptrdiff_t i = last; first < i; i--)
+    {
+      fenwick_add (li->bytes, li->nchunks, i,
+		   fenwick_sum (li->bytes, i - 1) - fenwick_sum (li->bytes, i));
+      fenwick_add (li->newlines, li->nchunks, i,
+		   (fenwick_sum (li->newlines, i - 1)
+		    - fenwick_sum (li->newlines, i)));
+    }
+
+  ptrdiff_t old_length = (fenwick_sum (li->bytes, first)
+			  - fenwick_sum (li->bytes, first - 1));
+  ptrdiff_t old_newlines = (fenwick_sum (li->newlines, first)
+			    - fenwick_sum (li->newlines, first - 1));
+  fenwick_add (li->bytes, li->nchunks, first, length - old_length);
+  fenwick_add (li->newlines, li->nchunks, first,
+	       (count_buffer_newlines (BEG_BYTE + start,
+				       BEG_BYTE + start + length)
+		- old_newlines));
+
+  li->chars = Z - BEG;
+  li->nbytes = Z_BYTE - BEG_BYTE;
+  li->beg_unchanged = li->end_unchanged = li->chars;
+
+  /* Start afresh if the merged chunk got too large, or if too many
+     chunks are now empty.  */
+  if (4 * LINE_INDEX_CHUNK < length
+      || 2 * (li->nbytes / LINE_INDEX_CHUNK + 1) < li->nchunks)
+    {
+      free_line_index (li);
+      li = make_line_index ();
+    }
+  return li;
+}
+
+/* Record that the text of BUF between the character positions START
+   and END is about to change, or has just changed, in the line index
+   of BUF, which must not be an indirect buffer.  */
+
+void
+invalidate_line_index (struct buffer *buf, ptrdiff_t start, ptrdiff_t end)
+{
+  struct line_index *li = buf->line_index;
+
+  li->beg_unchanged = min (li->beg_unchanged, start - BUF_BEG (buf));
+  li->end_unchanged = min (li->end_unchanged, BUF_Z (buf) - end);
+}
+
+/* Return the number of newlines in the current buffer between the
+   byte positions START_BYTE and END_BYTE, using the line index of the
+   buffer, and making one if needed.  Return -1 if there is no index
+   and making one costs more than counting the newlines directly, or
+   if the buffer doesn't want caches.  */
+
+ptrdiff_t
+line_index_count_newlines (ptrdiff_t start_byte, ptrdiff_t end_byte)
+{
+  struct buffer *buf = (current_buffer->base_buffer
+			? current_buffer->base_buffer : current_buffer);
+  ptrdiff_t span = end_byte - start_byte;
+
+  if (NILP (BVAR (current_buffer, cache_long_scans))
+      || NILP (BVAR (buf, cache_long_scans)))
+    {
+      if (buf->line_index)
+	{
+	  free_line_index (buf->line_index);
+	  buf->line_index = NULL;
+	}
+      return -1;
+    }
+
+  /* Counting the newlines of a chunk at each end costs about as much
+     as counting this many newlines directly.  */
+  if (span < 2 * LINE_INDEX_CHUNK)
+    return -1;
+
+  if (buf->line_index)
+    buf->line_index = revalidate_line_index (buf->line_index);
+  else if (span < (Z_BYTE - BEG_BYTE) / 4)
+    return -1;
+  else
+    buf->line_index = make_line_index ();
+
+  struct line_index *li = buf->line_index;
+  ptrdiff_t count = 0;
+  ptrdiff_t pos_byte[2] = { start_byte, end_byte };
+
+  for (int i = 0; i < 2; i++)
+    {
+      ptrdiff_t start;
+      ptrdiff_t chunk = line_index_chunk (li, pos_byte[i] - BEG_BYTE, &start);
+      ptrdiff_t newlines = (fenwick_sum (li->newlines, chunk - 1)
+			    + count_buffer_newlines (BEG_BYTE + start,
+						     pos_byte[i]));
+      count += i ? newlines : - newlines;
+    }
+  return count;
+}
+
 /* Search for COUNT newlines between START/START_BYTE and END/END_BYTE.
 
    If COUNT is positive, search forwards; END must be >= START.
@@ -796,15 +1135,31 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
 	  ptrdiff_t base = start_byte - lim_byte;
 	  ptrdiff_t cursor, next;
 
+	  /* Whether to record newline-free regions in the cache.
+	     Counting newlines in bulk leaves the cursor at arbitrary
+	     byte positions, and finds only short regions anyway.  */
+	  bool update_cache = newline_cache != NULL;
+
 	  for (cursor = base; cursor < 0; cursor = next)
 	    {
+	      ptrdiff_t bulk = bulk_count_newlines (lim_addr + cursor,
+						    - cursor, &count);
+	      if (bulk)
+		{
+		  next = cursor + bulk;
+		  update_cache = false;
+		  if (allow_quit)
+		    maybe_quit ();
+		  continue;
+		}
+
               /* The dumb loop.  */
 	      unsigned char *nl = memchr (lim_addr + cursor, '\n', - cursor);
 	      next = nl ? nl - lim_addr : 0;
 
               /* If we're using the newline cache, cache the fact that
                  the region we just traversed is free of newlines. */
-              if (newline_cache && cursor != next)
+              if (update_cache && cursor != next)
 		{
 		  know_region_cache (cache_buffer, newline_cache,
 				     BYTE_TO_CHAR (lim_byte + cursor),
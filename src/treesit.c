@@ -23,6 +23,7 @@ Copyright (C) 2021-2024 Free Software Foundation, Inc.
 #include "lisp.h"
 #include "buffer.h"
 #include "coding.h"
+#include "systime.h"
 
 #include "treesit.h"
 
@@ -63,8 +64,11 @@ Copyright (C) 2021-2024 Free Software Foundation, Inc.
 #undef ts_parser_language
 #undef ts_parser_new
 #undef ts_parser_parse
+#undef ts_parser_parse_with_options
+#undef ts_parser_reset
 #undef ts_parser_set_included_ranges
 #undef ts_parser_set_language
+#undef ts_parser_set_timeout_micros
 #undef ts_query_capture_name_for_id
 #undef ts_query_cursor_delete
 #undef ts_query_cursor_exec
@@ -122,9 +126,17 @@ DEF_DLL_FN (const TSRange *, ts_parser_included_ranges,
 DEF_DLL_FN (const TSLanguage *, ts_parser_language, (const TSParser *));
 DEF_DLL_FN (TSParser *, ts_parser_new, (void));
 DEF_DLL_FN (TSTree *, ts_parser_parse, (TSParser *, const TSTree *, TSInput));
+# ifdef HAVE_TS_PARSER_PARSE_WITH_OPTIONS
+DEF_DLL_FN (TSTree *, ts_parser_parse_with_options,
+	    (TSParser *, const TSTree *, TSInput, TSParseOptions));
+# endif
+DEF_DLL_FN (void, ts_parser_reset, (TSParser *));
 DEF_DLL_FN (bool, ts_parser_set_included_ranges,
 	    (TSParser *, const TSRange *, uint32_t));
 DEF_DLL_FN (bool, ts_parser_set_language, (TSParser *, const TSLanguage *));
+# ifndef HAVE_TS_PARSER_PARSE_WITH_OPTIONS
+DEF_DLL_FN (void, ts_parser_set_timeout_micros, (TSParser *, uint64_t));
+# endif
 DEF_DLL_FN (const char *, ts_query_capture_name_for_id,
 	    (const TSQuery *, uint32_t, uint32_t *));
 DEF_DLL_FN (void, ts_query_cursor_delete, (TSQueryCursor *));
@@ -195,6 +207,12 @@ init_treesit_functions (void)
   LOAD_DLL_FN (library, ts_parser_language);
   LOAD_DLL_FN (library, ts_parser_new);
   LOAD_DLL_FN (library, ts_parser_parse);
+# ifdef HAVE_TS_PARSER_PARSE_WITH_OPTIONS
+  LOAD_DLL_FN (library, ts_parser_parse_with_options);
+# else
+  LOAD_DLL_FN (library, ts_parser_set_timeout_micros);
+# endif
+  LOAD_DLL_FN (library, ts_parser_reset);
   LOAD_DLL_FN (library, ts_parser_set_included_ranges);
   LOAD_DLL_FN (library, ts_parser_set_language);
   LOAD_DLL_FN (library, ts_query_capture_name_for_id);
@@ -253,8 +271,11 @@ #define ts_parser_included_ranges fn_ts_parser_included_ranges
 #define ts_parser_language fn_ts_parser_language
 #define ts_parser_new fn_ts_parser_new
 #define ts_parser_parse fn_ts_parser_parse
+#define ts_parser_parse_with_options fn_ts_parser_parse_with_options
+#define ts_parser_reset fn_ts_parser_reset
 #define ts_parser_set_included_ranges fn_ts_parser_set_included_ranges
 #define ts_parser_set_language fn_ts_parser_set_language
+#define ts_parser_set_timeout_micros fn_ts_parser_set_timeout_micros
 #define ts_query_capture_name_for_id fn_ts_query_capture_name_for_id
 #define ts_query_cursor_delete fn_ts_query_cursor_delete
 #define ts_query_cursor_exec fn_ts_query_cursor_exec
@@ -304,7 +325,9 @@ #define ts_tree_root_node fn_ts_tree_root_node
 
    - I didn't expose setting timeout and cancellation flag for a
      parser, mainly because I don't think they are really necessary
-     in Emacs's use cases.
+     in Emacs's use cases.  Internally, we do set a timeout, so that a
+     long reparse runs in slices and the user can interrupt it with
+     C-g between two slices (see treesit_ensure_parsed).
 
    - Many tree-sitter functions take a TSPoint, which is basically a
      row and column.  Emacs uses a gap buffer and does not keep
@@ -422,6 +445,7 @@ #define ts_tree_root_node fn_ts_tree_root_node
 static Lisp_Object Vtreesit_str_plus;
 static Lisp_Object Vtreesit_str_pound_equal;
 static Lisp_Object Vtreesit_str_pound_match;
+static Lisp_Object Vtreesit_str_pound_any_of;
 static Lisp_Object Vtreesit_str_pound_pred;
 static Lisp_Object Vtreesit_str_open_bracket;
 static Lisp_Object Vtreesit_str_close_bracket;
@@ -430,6 +454,7 @@ #define ts_tree_root_node fn_ts_tree_root_node
 static Lisp_Object Vtreesit_str_space;
 static Lisp_Object Vtreesit_str_equal;
 static Lisp_Object Vtreesit_str_match;
+static Lisp_Object Vtreesit_str_any_of;
 static Lisp_Object Vtreesit_str_pred;
 
 /* This is the limit on recursion levels for some tree-sitter
@@ -443,6 +468,14 @@ #define ts_tree_root_node fn_ts_tree_root_node
    we look at xdisp.c, its AST only have 30 levels.  */
 #define TREESIT_RECURSION_LIMIT 1000
 
+/* Tree-sitter gives up a parse after this many microseconds, and we
+   check for quit before resuming it.  With tree-sitter 0.25 and later,
+   the limit is enforced by treesit_parse_progress; with older versions,
+   it is set as the parser's timeout.  This is long enough that the
+   overhead of resuming is negligible, and short enough that C-g
+   feels instantaneous.  */
+#define TREESIT_PARSE_SLICE_MICROS 50000
+
 static bool treesit_initialized = false;
 
 static bool
@@ -1225,6 +1258,51 @@ treesit_call_after_change_functions (TSTree *old_tree, TSTree *new_tree,
   unbind_to (count, Qnil);
 }
 
+/* Clean up after treesit_ensure_parsed on PARSER.  If the reparse was
+   interrupted by a non-local exit, tree-sitter keeps the state of the
+   unfinished parse to resume it on the next call, but by then the
+   buffer might have changed, so discard that state.  The old tree is
+   still valid, and need_reparse is still set, so the next call starts
+   over.  */
+static void
+treesit_abandon_reparse (void *parser)
+{
+  struct Lisp_TS_Parser *lisp_parser = parser;
+  ts_parser_reset (lisp_parser->parser);
+  lisp_parser->within_reparse = false;
+}
+
+#ifdef HAVE_TS_PARSER_PARSE_WITH_OPTIONS
+/* Progress callback for ts_parser_parse_with_options.  Return true,
+   which cancels the parse, once the deadline that STATE's payload
+   points to has passed.  */
+static bool
+treesit_parse_progress (TSParseState *state)
+{
+  struct timespec *deadline = state->payload;
+  return timespec_cmp (*deadline, current_timespec ()) <= 0;
+}
+#endif
+
+/* Parse with PARSER for at most TREESIT_PARSE_SLICE_MICROS, and
+   return the new tree, or NULL if the parse is not finished.  Calling
+   this again with the same arguments resumes the parse.  TREE and
+   INPUT are as for ts_parser_parse.  */
+static TSTree *
+treesit_parse_slice (TSParser *parser, TSTree *tree, TSInput input)
+{
+#ifdef HAVE_TS_PARSER_PARSE_WITH_OPTIONS
+  struct timespec deadline
+    = timespec_add (current_timespec (),
+		    make_timespec (0, TREESIT_PARSE_SLICE_MICROS * 1000));
+  TSParseOptions options = { .payload = &deadline,
+			     .progress_callback = treesit_parse_progress };
+  return ts_parser_parse_with_options (parser, tree, input, options);
+#else
+  return ts_parser_parse (parser, tree, input);
+#endif
+}
+
 /* Parse the buffer.  We don't parse until we have to.  When we have
    to, we call this function to parse and update the tree.  */
 static void
@@ -1232,6 +1310,8 @@ treesit_ensure_parsed (Lisp_Object parser)
 {
   if (XTS_PARSER (parser)->within_reparse) return;
   XTS_PARSER (parser)->within_reparse = true;
+  specpdl_ref count = SPECPDL_INDEX ();
+  record_unwind_protect_ptr (treesit_abandon_reparse, XTS_PARSER (parser));
 
   struct buffer *buffer = XBUFFER (XTS_PARSER (parser)->buffer);
 
@@ -1243,7 +1323,7 @@ treesit_ensure_parsed (Lisp_Object parser)
 
   if (!XTS_PARSER (parser)->need_reparse)
     {
-      XTS_PARSER (parser)->within_reparse = false;
+      unbind_to (count, Qnil);
       return;
     }
 
@@ -1251,19 +1331,29 @@ treesit_ensure_parsed (Lisp_Object parser)
   TSTree *tree = XTS_PARSER (parser)->tree;
   TSInput input = XTS_PARSER (parser)->input;
 
-  TSTree *new_tree = ts_parser_parse (treesit_parser, tree, input);
-  /* This should be very rare (impossible, really): it only happens
-     when 1) language is not set (impossible in Emacs because the user
-     has to supply a language to create a parser), 2) parse canceled
-     due to timeout (impossible because we don't set a timeout), 3)
-     parse canceled due to cancellation flag (impossible because we
-     don't set the flag).  (See comments for ts_parser_parse in
-     tree_sitter/api.h.)  */
-  if (new_tree == NULL)
+  /* treesit_parse_slice returns NULL when 1) language is not set
+     (impossible in Emacs because the user has to supply a language to
+     create a parser), 2) the slice ran out of time, 3) parse canceled
+     due to cancellation flag (impossible because we don't set the
+     flag).  (See comments for ts_parser_parse in tree_sitter/api.h.)
+     Running out of time means the parse is not finished yet: check
+     for quit and resume it with the same arguments.  This relies on
+     the invariant that nothing can modify the buffer between slices:
+     whatever maybe_quit handles (quit, pending input, atimers) must
+     either leave the buffer text alone or exit non-locally, and in the
+     latter case treesit_abandon_reparse discards the unfinished
+     parse.  */
+  TSTree *new_tree;
+  while ((new_tree = treesit_parse_slice (treesit_parser, tree, input))
+	 == NULL)
     {
-      Lisp_Object buf;
-      XSETBUFFER (buf, buffer);
-      xsignal1 (Qtreesit_parse_error, buf);
+      if (ts_parser_language (treesit_parser) == NULL)
+	{
+	  Lisp_Object buf;
+	  XSETBUFFER (buf, buffer);
+	  xsignal1 (Qtreesit_parse_error, buf);
+	}
+      maybe_quit ();
     }
 
   XTS_PARSER (parser)->tree = new_tree;
@@ -1273,7 +1363,7 @@ treesit_ensure_parsed (Lisp_Object parser)
   treesit_call_after_change_functions (tree, new_tree, parser);
   ts_tree_delete (tree);
 
-  XTS_PARSER (parser)->within_reparse = false;
+  unbind_to (count, Qnil);
 }
 
 /* This is the read function provided to tree-sitter to read from a
@@ -1389,10 +1479,11 @@ make_treesit_query (Lisp_Object query, Lisp_Object language)
   struct Lisp_TS_Query *lisp_query;
 
   lisp_query = ALLOCATE_PSEUDOVECTOR (struct Lisp_TS_Query,
-				      source, PVEC_TS_COMPILED_QUERY);
+				      predicates, PVEC_TS_COMPILED_QUERY);
 
   lisp_query->language = language;
   lisp_query->source = query;
+  lisp_query->predicates = Qnil;
   lisp_query->query = NULL;
   lisp_query->cursor = NULL;
   return make_lisp_ptr (lisp_query, Lisp_Vectorlike);
@@ -1667,6 +1758,9 @@ DEFUN ("treesit-parser-create",
   /* We check language version when loading a language, so this should
      always succeed.  */
   ts_parser_set_language (parser, lang);
+#ifndef HAVE_TS_PARSER_PARSE_WITH_OPTIONS
+  ts_parser_set_timeout_micros (parser, TREESIT_PARSE_SLICE_MICROS);
+#endif
 
   /* Create parser.  */
   Lisp_Object lisp_parser = make_treesit_parser (buf_orig,
@@ -2690,6 +2784,7 @@ DEFUN ("treesit-pattern-expand",
     :+
     :equal
     :match
+    :any-of
     (TYPE PATTERN...)
     [PATTERN...]
     FIELD-NAME:
@@ -2713,6 +2808,8 @@ DEFUN ("treesit-pattern-expand",
     return Vtreesit_str_pound_equal;
   if (BASE_EQ (pattern, QCmatch))
     return Vtreesit_str_pound_match;
+  if (BASE_EQ (pattern, QCany_of))
+    return Vtreesit_str_pound_any_of;
   if (BASE_EQ (pattern, QCpred))
     return Vtreesit_str_pound_pred;
   Lisp_Object opening_delimeter
@@ -2746,6 +2843,7 @@ DEFUN ("treesit-query-expand",
     :+
     :equal
     :match
+    :any-of
     (TYPE PATTERN...)
     [PATTERN...]
     FIELD-NAME:
@@ -2850,26 +2948,92 @@ treesit_predicate_capture_name_to_node (Lisp_Object name,
   return true;
 }
 
-/* Translate a capture NAME (symbol) to the text of the captured node.
-   If everything goes fine, set TEXT to the text and return true;
-   otherwise set TEXT to Qnil and set SIGNAL_DATA to a suitable signal
-   data.  */
+/* Translate a predicate argument ARG, either a string or a capture
+   name (symbol), to something treesit_predicate_text_equal accepts:
+   the string itself, or the node captured under that name.  If
+   everything goes fine, set TEXT and return true; otherwise set TEXT
+   to Qnil and set SIGNAL_DATA to a suitable signal data.  */
 static bool
-treesit_predicate_capture_name_to_text (Lisp_Object name,
-					struct capture_range captures,
-					Lisp_Object *text,
-					Lisp_Object *signal_data)
+treesit_predicate_arg_to_text (Lisp_Object arg,
+			       struct capture_range captures,
+			       Lisp_Object *text,
+			       Lisp_Object *signal_data)
 {
-  Lisp_Object node = Qnil;
-  if (!treesit_predicate_capture_name_to_node (name, captures, &node, signal_data))
-    return false;
+  if (!SYMBOLP (arg))
+    {
+      *text = arg;
+      return true;
+    }
+  return treesit_predicate_capture_name_to_node (arg, captures, text,
+						 signal_data);
+}
 
-  struct buffer *old_buffer = current_buffer;
-  set_buffer_internal (XBUFFER (XTS_PARSER (XTS_NODE (node)->parser)->buffer));
-  *text = Fbuffer_substring (Ftreesit_node_start (node),
-			     Ftreesit_node_end (node));
-  set_buffer_internal (old_buffer);
-  return true;
+/* Return the buffer of NODE, and set *BEG_BYTE and *END_BYTE to the
+   byte positions of the text that NODE spans in it.  Signal an error,
+   like `buffer-substring' would, if that text is not within the
+   accessible portion of the buffer.  */
+static struct buffer *
+treesit_node_byte_range (Lisp_Object node, ptrdiff_t *beg_byte,
+			 ptrdiff_t *end_byte)
+{
+  struct Lisp_TS_Parser *parser = XTS_PARSER (XTS_NODE (node)->parser);
+  struct buffer *buffer = XBUFFER (parser->buffer);
+  *beg_byte = parser->visible_beg + ts_node_start_byte (XTS_NODE (node)->node);
+  *end_byte = parser->visible_beg + ts_node_end_byte (XTS_NODE (node)->node);
+  if (!(BUF_BEGV_BYTE (buffer) <= *beg_byte
+	&& *beg_byte <= *end_byte
+	&& *end_byte <= BUF_ZV_BYTE (buffer)))
+    args_out_of_range (Ftreesit_node_start (node), Ftreesit_node_end (node));
+  return buffer;
+}
+
+/* Return true if TEXT1 and TEXT2 are the same text.  Each one is
+   either a string or a node, which stands for the text it spans in
+   its buffer.  This is like calling `string-equal' on the strings and
+   on the `buffer-substring' of the nodes, but compares the text in
+   place.  */
+static bool
+treesit_predicate_text_equal (Lisp_Object text1, Lisp_Object text2)
+{
+  if (STRINGP (text1) && STRINGP (text2))
+    return !NILP (Fstring_equal (text1, text2));
+  if (STRINGP (text1))
+    {
+      Lisp_Object tem = text1;
+      text1 = text2;
+      text2 = tem;
+    }
+
+  ptrdiff_t beg1, end1;
+  struct buffer *buf1 = treesit_node_byte_range (text1, &beg1, &end1);
+  ptrdiff_t nbytes = end1 - beg1;
+
+  /* string-equal compares the bytes and the number of characters.  */
+  if (STRINGP (text2))
+    {
+      if (SBYTES (text2) != nbytes)
+	return false;
+      for (ptrdiff_t i = 0; i < nbytes; i++)
+	if (BUF_FETCH_BYTE (buf1, beg1 + i) != SREF (text2, i))
+	  return false;
+      return (SCHARS (text2)
+	      == (buf_bytepos_to_charpos (buf1, end1)
+		  - buf_bytepos_to_charpos (buf1, beg1)));
+    }
+
+  ptrdiff_t beg2, end2;
+  struct buffer *buf2 = treesit_node_byte_range (text2, &beg2, &end2);
+  if (end2 - beg2 != nbytes)
+    return false;
+  for (ptrdiff_t i = 0; i < nbytes; i++)
+    if (BUF_FETCH_BYTE (buf1, beg1 + i) != BUF_FETCH_BYTE (buf2, beg2 + i))
+      return false;
+  /* In the same buffer, the same bytes mean the same characters.  */
+  return (buf1 == buf2
+	  || ((buf_bytepos_to_charpos (buf1, end1)
+	       - buf_bytepos_to_charpos (buf1, beg1))
+	      == (buf_bytepos_to_charpos (buf2, end2)
+		  - buf_bytepos_to_charpos (buf2, beg2))));
 }
 
 /* Handles predicate (#equal A B).  Return true if A equals B; return
@@ -2888,24 +3052,54 @@ treesit_predicate_equal (Lisp_Object args, struct capture_range captures,
 			    Flength (args));
       return false;
     }
-  Lisp_Object arg1 = XCAR (args);
-  Lisp_Object arg2 = XCAR (XCDR (args));
-  Lisp_Object text1 = arg1;
-  Lisp_Object text2 = arg2;
-  if (SYMBOLP (arg1))
+  Lisp_Object text1, text2;
+  if (!treesit_predicate_arg_to_text (XCAR (args), captures, &text1,
+				      signal_data)
+      || !treesit_predicate_arg_to_text (XCAR (XCDR (args)), captures,
+					 &text2, signal_data))
+    return false;
+
+  return treesit_predicate_text_equal (text1, text2);
+}
+
+/* Handles predicate (#any-of @node "string" ...).  Return true if the
+   text spanned by @node equals one of the strings; return false
+   otherwise.  If everything goes fine, don't touch SIGNAL_DATA; if
+   error occurs, set it to a suitable signal data.  */
+static bool
+treesit_predicate_any_of (Lisp_Object args, struct capture_range captures,
+			  Lisp_Object *signal_data)
+{
+  if (list_length (args) < 2)
     {
-      if (!treesit_predicate_capture_name_to_text (arg1, captures, &text1,
-						   signal_data))
-	return false;
+      *signal_data = list2 (build_string ("Predicate `any-of' requires "
+					  "at least two arguments, "
+					  "but only got"),
+			    Flength (args));
+      return false;
     }
-  if (SYMBOLP (arg2))
+  Lisp_Object capture_name = XCAR (args);
+  if (!SYMBOLP (capture_name))
+    xsignal1 (Qtreesit_query_error,
+	      build_string ("The first argument to `any-of' should "
+			    "be a capture name, not a string"));
+
+  Lisp_Object node;
+  if (!treesit_predicate_capture_name_to_node (capture_name, captures, &node,
+					       signal_data))
+    return false;
+
+  for (Lisp_Object tail = XCDR (args); CONSP (tail); tail = XCDR (tail))
     {
-      if (!treesit_predicate_capture_name_to_text (arg2, captures, &text2,
-						   signal_data))
-	return false;
+      if (!STRINGP (XCAR (tail)))
+	xsignal1 (Qtreesit_query_error,
+		  build_string ("The arguments to `any-of' after the "
+				"first should be strings, not capture "
+				"names"));
+      if (treesit_predicate_text_equal (node, XCAR (tail)))
+	return true;
     }
-
-  return !NILP (Fstring_equal (text1, text2));
+  return false;
 }
 
 /* Handles predicate (#match "regexp" @node).  Return true if "regexp"
@@ -3025,14 +3219,16 @@ treesit_eval_predicates (struct capture_range captures, Lisp_Object predicates,
 	pass &= treesit_predicate_equal (args, captures, signal_data);
       else if (!NILP (Fstring_equal (fn, Vtreesit_str_match)))
 	pass &= treesit_predicate_match (args, captures, signal_data);
+      else if (!NILP (Fstring_equal (fn, Vtreesit_str_any_of)))
+	pass &= treesit_predicate_any_of (args, captures, signal_data);
       else if (!NILP (Fstring_equal (fn, Vtreesit_str_pred)))
 	pass &= treesit_predicate_pred (args, captures, signal_data);
       else
 	{
 	  *signal_data = list3 (build_string ("Invalid predicate"),
 				fn, build_string ("Currently Emacs only supports"
-						  " `equal', `match', and `pred'"
-						  " predicates"));
+						  " `equal', `match', `any-of',"
+						  " and `pred' predicates"));
 	  pass = false;
 	}
     }
@@ -3276,7 +3472,19 @@ DEFUN ("treesit-query-capture",
   uint32_t patterns_count = ts_query_pattern_count (treesit_query);
   Lisp_Object result = Qnil;
   Lisp_Object prev_result = result;
-  Lisp_Object predicates_table = make_vector (patterns_count, Qt);
+  /* A compiled query keeps its predicates across calls, so that
+     repeated queries, like those of font-lock, don't cons them up
+     again each time.  */
+  Lisp_Object predicates_table;
+  if (TS_COMPILED_QUERY_P (query))
+    {
+      if (NILP (XTS_COMPILED_QUERY (query)->predicates))
+	XTS_COMPILED_QUERY (query)->predicates
+	  = make_vector (patterns_count, Qt);
+      predicates_table = XTS_COMPILED_QUERY (query)->predicates;
+    }
+  else
+    predicates_table = make_vector (patterns_count, Qt);
   Lisp_Object predicate_signal_data = Qnil;
 
   struct buffer *old_buf = current_buffer;
@@ -4286,6 +4494,7 @@ syms_of_treesit (void)
   DEFSYM (QCplus, ":+");
   DEFSYM (QCequal, ":equal");
   DEFSYM (QCmatch, ":match");
+  DEFSYM (QCany_of, ":any-of");
   DEFSYM (QCpred, ":pred");
 
   DEFSYM (Qnot_found, "not-found");
@@ -4434,6 +4643,8 @@ cons (REGEXP . FN), which is a combination of a regexp and a predicate
   Vtreesit_str_pound_equal = build_pure_c_string ("#equal");
   staticpro (&Vtreesit_str_pound_match);
   Vtreesit_str_pound_match = build_pure_c_string ("#match");
+  staticpro (&Vtreesit_str_pound_any_of);
+  Vtreesit_str_pound_any_of = build_pure_c_string ("#any-of");
   staticpro (&Vtreesit_str_pound_pred);
   Vtreesit_str_pound_pred = build_pure_c_string ("#pred");
   staticpro (&Vtreesit_str_open_bracket);
@@ -4450,6 +4661,8 @@ cons (REGEXP . FN), which is a combination of a regexp and a predicate
   Vtreesit_str_equal = build_pure_c_string ("equal");
   staticpro (&Vtreesit_str_match);
   Vtreesit_str_match = build_pure_c_string ("match");
+  staticpro (&Vtreesit_str_any_of);
+  Vtreesit_str_any_of = build_pure_c_string ("any-of");
   staticpro (&Vtreesit_str_pred);
   Vtreesit_str_pred = build_pure_c_string ("pred");
 
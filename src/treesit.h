@@ -141,6 +141,11 @@ #define EMACS_TREESIT_H
   Lisp_Object language;
   /* Source lisp (sexp or string) query.  */
   Lisp_Object source;
+  /* A vector holding the predicates of each pattern, as returned by
+     treesit_predicates_for_pattern, or nil if not computed yet.  An
+     element is t if the predicates of that pattern are not computed
+     yet.  */
+  Lisp_Object predicates;
   /* Pointer to the query object.  This can be NULL, meaning this query
      is not initialized/compiled.  We compile the query when it is used
      the first time.  (See treesit_ensure_query_compiled.)  */
@@ -2975,28 +2975,37 @@ DEFUN ("previous-window", Fprevious_window, Sprevious_window, 0, 3, 0,
 static Lisp_Object
 window_list_1 (Lisp_Object window, Lisp_Object minibuf, Lisp_Object all_frames)
 {
-  Lisp_Object tail, list, rest;
+  Lisp_Object tail, list, last, rest;
   specpdl_ref count = SPECPDL_INDEX ();
 
   decode_next_window_args (&window, &minibuf, &all_frames);
-  list = Qnil;
+  list = last = Qnil;
 
-  /*  Don't allow quitting in Fmemq and Fnconc.  */
+  /*  Don't allow quitting in Fmemq.  */
   specbind (Qinhibit_quit, Qt);
 
+  /* Build the list in order with XSETCDR, since the Fsetcdr of
+     Fnreverse and Fnconc would flush the keymap caches.  */
   for (tail = window_list (); CONSP (tail); tail = XCDR (tail))
     if (candidate_window_p (XCAR (tail), window, minibuf, all_frames))
-      list = Fcons (XCAR (tail), list);
+      {
+	Lisp_Object cell = list1 (XCAR (tail));
+	if (NILP (last))
+	  list = cell;
+	else
+	  XSETCDR (last, cell);
+	last = cell;
+      }
 
   /* Rotate the list to start with WINDOW.  */
-  list = Fnreverse (list);
   rest = Fmemq (window, list);
   if (!NILP (rest) && !EQ (rest, list))
     {
       for (tail = list; !EQ (XCDR (tail), rest); tail = XCDR (tail))
 	;
       XSETCDR (tail, Qnil);
-      list = nconc2 (rest, list);
+      XSETCDR (last, list);
+      list = rest;
     }
 
   unbind_to (count, Qnil);
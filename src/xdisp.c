@@ -119,6 +119,19 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
    matrix that correspond to the mode lines, header lines, and
    tab-lines of the windows which need that; see `display_mode_lines'.
 
+   The windows are considered one after the other, and this step
+   cannot be split among several threads, even for windows showing
+   different buffers.  `redisplay_window' makes the window's buffer
+   current, may call Lisp (`fontification-functions', :eval forms in
+   the mode line, `window-scroll-functions', etc.), which can change
+   any global state, including the text of other buffers, and it
+   shares the frame's face cache, the glyph row pools and the
+   iterator's global caches with every other window.  What keeps this
+   step cheap when a frame has many windows is the `redisplay' flag
+   of each window, buffer and frame: windows that don't need to be
+   redisplayed are skipped by `needs_no_redisplay' without examining
+   their text.
+
    In the third and last step, the current and desired matrix are then
    compared to find a cheap way to update the display, e.g. by reusing
    part of the display by scrolling lines.  The actual update of the
@@ -1613,6 +1626,37 @@ default_line_pixel_height (struct window *w)
   return height;
 }
 
+/* Return the typical pixel height of a screen line in window W, for
+   estimating how many lines span a given vertical distance.  If W's
+   current matrix is up to date, it records the actual heights of the
+   lines W displays, which reflect faces and images larger or smaller
+   than the default font, so use the average height of its text rows.
+   Otherwise, fall back on default_line_pixel_height.  */
+static int
+estimated_line_pixel_height (struct window *w)
+{
+  struct glyph_matrix *matrix = w->current_matrix;
+
+  if (matrix && matrix->rows
+      && w->window_end_valid
+      && BUFFERP (w->contents) && XBUFFER (w->contents) == current_buffer)
+    {
+      struct glyph_row *row = MATRIX_FIRST_TEXT_ROW (matrix);
+      struct glyph_row *end = MATRIX_BOTTOM_TEXT_ROW (matrix, w);
+      int nrows = 0, total_height = 0;
+
+      for (; row < end && row->enabled_p && !row->mode_line_p; row++)
+	{
+	  nrows++;
+	  total_height += row->height;
+	}
+      if (nrows > 0 && total_height >= nrows)
+	return total_height / nrows;
+    }
+
+  return default_line_pixel_height (w);
+}
+
 /* Subroutine of pos_visible_p below.  Extracts a display string, if
    any, from the display spec given as its argument.  */
 static Lisp_Object
@@ -3672,11 +3716,12 @@ get_nearby_bol_pos (ptrdiff_t pos)
     {
       pos_bytepos = pos == BEGV ? BEGV_BYTE : CHAR_TO_BYTE (pos);
       start = pos - dist < BEGV ? BEGV : pos - dist;
+      ptrdiff_t cur_bytepos = CHAR_TO_BYTE (start);
       for (cur = start; cur < pos; cur = next)
 	{
-	  next = find_newline1 (cur, CHAR_TO_BYTE (cur),
+	  next = find_newline1 (cur, cur_bytepos,
 				pos, pos_bytepos,
-				1, &found, NULL, false);
+				1, &found, &cur_bytepos, false);
 	  if (found)
 	    bol = next;
 	  else
@@ -3706,12 +3751,13 @@ get_large_narrowing_begv (ptrdiff_t pos)
     return BEGV;
   ptrdiff_t len = long_line_optimizations_region_size / 2;
   ptrdiff_t begv = max (pos - len, BEGV);
+  ptrdiff_t begv_byte = CHAR_TO_BYTE (begv);
   ptrdiff_t limit = long_line_optimizations_bol_search_limit;
   while (limit > 0)
     {
-      if (begv == BEGV || FETCH_BYTE (CHAR_TO_BYTE (begv) - 1) == '\n')
+      if (begv == BEGV || FETCH_BYTE (begv_byte - 1) == '\n')
 	return begv;
-      begv--;
+      dec_both (&begv, &begv_byte);
       limit--;
     }
   return begv;
@@ -3726,6 +3772,42 @@ get_large_narrowing_zv (ptrdiff_t pos)
   return min (pos + len, ZV);
 }
 
+/* Return true if the accessible portion of the current buffer has a
+   line, including its newline, longer than THRESHOLD characters.
+
+   This is called by every redisplay of a buffer that was modified
+   and doesn't have long lines yet, so it must be fast.  Look for the
+   newlines with memchr over each contiguous stretch of bytes, and
+   convert byte positions to character positions only for lines that
+   have more than THRESHOLD bytes, since a line cannot have more
+   characters than bytes.  */
+static bool
+accessible_region_has_long_lines (ptrdiff_t threshold)
+{
+  ptrdiff_t bol_byte = BEGV_BYTE;
+
+  for (ptrdiff_t pos_byte = BEGV_BYTE; pos_byte < ZV_BYTE; )
+    {
+      ptrdiff_t end_byte = min (BUFFER_CEILING_OF (pos_byte), ZV_BYTE - 1) + 1;
+      unsigned char *base = BYTE_POS_ADDR (pos_byte);
+      unsigned char *lim = base + (end_byte - pos_byte);
+
+      for (unsigned char *p = base;
+	   (p = memchr (p, '\n', lim - p)) != NULL; )
+	{
+	  ptrdiff_t eol_byte = pos_byte + (++p - base);
+	  if (eol_byte - bol_byte > threshold
+	      && BYTE_TO_CHAR (eol_byte) - BYTE_TO_CHAR (bol_byte) > threshold)
+	    return true;
+	  bol_byte = eol_byte;
+	}
+      pos_byte = end_byte;
+    }
+
+  return (ZV_BYTE - bol_byte > threshold
+	  && ZV - BYTE_TO_CHAR (bol_byte) > threshold);
+}
+
 static void
 unwind_narrowed_begv (Lisp_Object point_min)
 {
@@ -11094,7 +11176,7 @@ move_it_vertically_backward (struct it *it, int dy)
   start_pos = IT_CHARPOS (*it);
 
   /* Estimate how many newlines we must move back.  */
-  nlines = max (1, dy / default_line_pixel_height (it->w));
+  nlines = dy > 0 ? max (1, dy / estimated_line_pixel_height (it->w)) : 1;
   if (it->line_wrap == TRUNCATE || nchars_per_row == 0)
     pos_limit = BEGV;
   else
@@ -20224,20 +20306,9 @@ redisplay_window (Lisp_Object window, bool just_this_one_p)
   if (!NILP (Vlong_line_threshold)
       && !current_buffer->long_line_optimizations_p
       && (CHARS_MODIFF - UNCHANGED_MODIFIED > 8
-	  || current_buffer->clip_changed))
-    {
-      ptrdiff_t cur, next, found, max = 0, threshold;
-      threshold = XFIXNUM (Vlong_line_threshold);
-      for (cur = BEGV; cur < ZV; cur = next)
-	{
-	  next = find_newline1 (cur, CHAR_TO_BYTE (cur), 0, -1, 1,
-				&found, NULL, true);
-	  if (next - cur > max) max = next - cur;
-	  if (!found || max > threshold) break;
-	}
-      if (max > threshold)
-	current_buffer->long_line_optimizations_p = true;
-    }
+	  || current_buffer->clip_changed)
+      && accessible_region_has_long_lines (XFIXNUM (Vlong_line_threshold)))
+    current_buffer->long_line_optimizations_p = true;
 
   /* If window-start is screwed up, choose a new one.  */
   if (XMARKER (w->start)->buffer != current_buffer)
@@ -29105,6 +29176,18 @@ display_count_lines (ptrdiff_t start_byte,
     = (!NILP (BVAR (current_buffer, selective_display))
        && !FIXNUMP (BVAR (current_buffer, selective_display)));
 
+  /* In large buffers, the line index can count the lines without
+     looking at most of the text.  */
+  if (count > 0 && !selective_display)
+    {
+      ptrdiff_t nlines = line_index_count_newlines (start_byte, limit_byte);
+      if (0 <= nlines && nlines < count)
+	{
+	  *byte_pos_ptr = limit_byte;
+	  return nlines;
+	}
+    }
+
   if (count > 0)
     {
       while (start_byte < limit_byte)
@@ -29126,6 +29209,14 @@ display_count_lines (ptrdiff_t start_byte,
 		}
 	      else
 		{
+		  ptrdiff_t bulk = bulk_count_newlines (cursor,
+							ceiling_addr - cursor,
+							&count);
+		  if (bulk)
+		    {
+		      cursor += bulk;
+		      continue;
+		    }
 		  cursor = memchr (cursor, '\n', ceiling_addr - cursor);
 		  if (! cursor)
 		    break;
@@ -851,6 +851,24 @@ bytecomp-tests-dynbind
         (should (equal (bytecomp-tests--eval-interpreted form)
                        (bytecomp-tests--eval-compiled form)))))))
 
+(ert-deftest bytecomp-tests-superinstructions ()
+  "Check that various expressions behave the same when interpreted and
+byte-compiled with superinstructions."
+  (let ((lexical-binding t)
+        (byte-compile-superinstructions t))
+    (dolist (form (append bytecomp-tests--test-cases-lexbind-only
+                          bytecomp-tests--test-cases))
+      (ert-info ((prin1-to-string form) :prefix "form: ")
+        (should (equal (bytecomp-tests--eval-interpreted form)
+                       (bytecomp-tests--eval-compiled form))))))
+  ;; Superinstructions are split again when code is inlined.
+  (let* ((byte-compile-superinstructions t)
+         (f (byte-compile (lambda (x y) (if (eq (car x) y) 'yes 'no))))
+         (g (byte-compile `(lambda (l) (list (,f l 'a) (,f l 'b))))))
+    (should (string-search (unibyte-string byte-eq-goto-if-nil)
+                           (aref f 1)))
+    (should (equal (funcall g '(a)) '(yes no)))))
+
 (ert-deftest bytecomp--fun-value-as-head ()
   ;; Check that (FUN-VALUE ...) is a valid call, for compatibility (bug#68931).
   ;; (There is also a warning but this test does not check that.)
@@ -46,6 +46,35 @@ completion-test1
         (should (equal (buffer-string)
                        "test: "))))))
 
+(ert-deftest completion-table-with-index-test ()
+  (let* ((alist '(("apple" . 1) ("Apricot" . 2) ("banana" . 3)
+                  ("apply" . 4) (bar . 5) (42 . 6)))
+         (table (completion-table-with-index alist))
+         (hash (make-hash-table :test #'equal))
+         (odd (lambda (elt) (cl-oddp (cdr elt)))))
+    (dolist (elt alist)
+      (puthash (car elt) (cdr elt) hash))
+    (dolist (coll (list alist hash obarray))
+      (let ((indexed (completion-table-with-index coll)))
+        (dolist (string '("" "a" "ap" "app" "appl" "apple" "b" "ba" "z"
+                          "car" "completion-table-w"))
+          (ert-info (string)
+            (should (equal (try-completion string indexed)
+                           (try-completion string coll)))
+            (should (equal (sort (all-completions string indexed))
+                           (sort (all-completions string coll))))
+            (should (equal (test-completion string indexed)
+                           (test-completion string coll)))))))
+    (let ((completion-ignore-case t))
+      (should (equal (sort (all-completions "AP" table))
+                     '("Apricot" "apple" "apply"))))
+    (should (equal (all-completions "ap" table odd) '("apple")))
+    (should (equal (all-completions "ap" (completion-table-with-index hash)
+                                    (lambda (_k v) (cl-evenp v)))
+                   '("apply")))
+    (let ((completion-regexp-list '("y\\'")))
+      (should (equal (all-completions "ap" table) '("apply"))))))
+
 (ert-deftest completion-table-with-predicate-test ()
   (let ((full-collection
          '("apple"                      ; Has A.
@@ -59,4 +59,23 @@ aset-nbytes-change
       (aset s 0 c)
       (should (equal s (make-string 1 c))))))
 
+(ert-deftest alloc-tests--gc-pause-statistics ()
+  (let ((gcs gcs-done))
+    (garbage-collect)
+    (should (> gcs-done gcs)))
+  (should (floatp gc-last-elapsed))
+  (should (<= 0.0 gc-last-elapsed gc-max-elapsed gc-elapsed)))
+
+(ert-deftest alloc-tests--string-data-statistics ()
+  (let ((strings (list (make-string 10 ?a) (make-string 5000 ?b))))
+    (garbage-collect)
+    (pcase-dolist (`(,class ,blocks ,live ,free ,fragmented)
+                   (string-data-statistics))
+      (should (memq class '(small large)))
+      (should (natnump blocks))
+      (should (natnump free))
+      (should (natnump fragmented))
+      (should (>= live (if (eq class 'large) 5000 10))))
+    (should (= (length strings) 2))))
+
 ;;; alloc-tests.el ends here
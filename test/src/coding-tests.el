@@ -430,5 +430,86 @@ coding-check-coding-systems-region
                  '((iso-latin-1 3) (us-ascii 1 3))))
   (should-error (check-coding-systems-region "å" nil '(bad-coding-system))))
 
+;; Writing and reading text that is long enough to be scanned a word
+;; at a time, with the characters that stop those scans.
+(ert-deftest coding-utf-8-file-round-trip ()
+  (unwind-protect
+      (let ((file (progn (or (file-directory-p coding-tests-workdir)
+                             (mkdir coding-tests-workdir t))
+                         (expand-file-name "utf-8" coding-tests-workdir)))
+            (text (apply #'concat
+                         (make-list 100 "ASCII text\twith tabs\nhéllo ∀ 𝕏\n"))))
+        (dolist (extra (list "" "\r\n" "\0" "\e" (string #x3fffc3)
+                             (string #x110000)))
+          (let ((contents (concat text extra text)))
+            (dolist (coding '(utf-8-unix utf-8 undecided))
+              (let ((coding-system-for-write 'utf-8-unix))
+                (write-region contents nil file nil 'silent))
+              (with-temp-buffer
+                (set-buffer-multibyte nil)
+                (insert-file-contents-literally file)
+                (should (equal (buffer-string)
+                               (encode-coding-string contents 'utf-8-unix))))
+              (with-temp-buffer
+                (let ((coding-system-for-read coding))
+                  (insert-file-contents file))
+                ;; Text detected as binary decodes to a unibyte string,
+                ;; but is inserted as raw-byte characters.
+                (should (equal (buffer-string)
+                               (string-to-multibyte
+                                (decode-coding-string
+                                 (encode-coding-string contents 'utf-8-unix)
+                                 coding)))))))))
+    (coding-tests-remove-files)))
+
+;; Test the decoding of single-byte coding systems and raw-text
+;; in insert-file-contents.
+(ert-deftest coding-single-byte-file-contents ()
+  (unwind-protect
+      (let ((file (progn (or (file-directory-p coding-tests-workdir)
+                             (mkdir coding-tests-workdir t))
+                         (expand-file-name "single-byte" coding-tests-workdir)))
+            (bytes (apply #'unibyte-string (number-sequence 0 255))))
+        (dolist (contents (list bytes (concat "a\r\nb\r\n" bytes)
+                                (apply #'concat (make-list 1000 bytes))))
+          (let ((coding-system-for-write 'no-conversion))
+            (write-region contents nil file nil 'silent))
+          (dolist (coding '(latin-1 latin-1-dos latin-1-unix cp1252 koi8-r
+                            us-ascii raw-text raw-text-dos))
+            (let ((decoded (string-to-multibyte
+                            (decode-coding-string contents coding))))
+              (with-temp-buffer
+                (insert "PRE POST")
+                (goto-char 4)
+                (let ((coding-system-for-read coding))
+                  (insert-file-contents file))
+                (should (equal (buffer-string)
+                               (concat "PRE" decoded " POST")))
+                (should (equal (get-text-property 4 'charset)
+                               (get-text-property 0 'charset decoded))))))))
+    (coding-tests-remove-files)))
+
+(ert-deftest coding-single-byte-write-region ()
+  (unwind-protect
+      (let ((file (progn (or (file-directory-p coding-tests-workdir)
+                             (mkdir coding-tests-workdir t))
+                         (expand-file-name "single-byte" coding-tests-workdir)))
+            (text (concat "abc\nÿ€ Ж ж Ω ½ ┼ 가 ™\t\0"
+                          (string #x3fff80 #x3fffff #x10ffff))))
+        (dolist (coding '(latin-1 iso-latin-9 cp1251 koi8-r cp437 ebcdic-us
+                          us-ascii))
+          (with-temp-buffer
+            (dotimes (_ 100)
+              (insert text))
+            (let ((coding-system-for-write coding)
+                  (select-safe-coding-system-function nil))
+              (write-region nil nil file nil 'silent))
+            (should (equal (with-temp-buffer
+                             (set-buffer-multibyte nil)
+                             (insert-file-contents-literally file)
+                             (buffer-string))
+                           (encode-coding-string (buffer-string) coding))))))
+    (coding-tests-remove-files)))
+
 (provide 'coding-tests)
 ;;; coding-tests.el ends here
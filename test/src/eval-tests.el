@@ -371,4 +371,42 @@ eval-bad-specbind
                 :type 'wrong-type-argument)
   (should-error (eval '(funcall '(lambda ((a b) 3.15) 84) 5 4))))
 
+(ert-deftest eval-tests--call-through-aliases ()
+  "Check calls from byte code to functions reached through aliases."
+  (let ((call (byte-compile (lambda (x) (eval-tests--alias-2 x)))))
+    (unwind-protect
+        (progn
+          (defalias 'eval-tests--alias-1
+            (byte-compile (lambda (x) (list 'closure x))))
+          (defalias 'eval-tests--alias-2 'eval-tests--alias-1)
+          (should (equal (funcall call 1) '(closure 1)))
+          (fset 'eval-tests--alias-1 #'list)
+          (should (equal (funcall call 2) '(2)))
+          (fset 'eval-tests--alias-1 (lambda (x) (list 'interpreted x)))
+          (should (equal (funcall call 3) '(interpreted 3)))
+          (fmakunbound 'eval-tests--alias-1)
+          (should (equal (should-error (funcall call 4) :type 'void-function)
+                         '(void-function eval-tests--alias-2))))
+      (fmakunbound 'eval-tests--alias-1)
+      (fmakunbound 'eval-tests--alias-2))))
+
+(defvar eval-tests--dyn 'global)
+(defvar eval-tests--unwound)
+
+(ert-deftest eval-tests--unbind-order ()
+  "Check that bindings and unwind forms are undone in reverse order."
+  (let ((eval-tests--unwound nil)
+        (f (byte-compile
+            (lambda ()
+              (let ((eval-tests--dyn 1))
+                (unwind-protect
+                    (let ((eval-tests--dyn 2)
+                          (case-fold-search 'bound))
+                      (throw 'done (list eval-tests--dyn case-fold-search)))
+                  (push eval-tests--dyn eval-tests--unwound)))))))
+    (should (equal (catch 'done (funcall f)) '(2 bound)))
+    (should (equal eval-tests--unwound '(1)))
+    (should (eq eval-tests--dyn 'global))
+    (should (eq case-fold-search (default-value 'case-fold-search)))))
+
 ;;; eval-tests.el ends here
@@ -201,6 +201,34 @@ fileio-tests--non-regular-insert
     (insert-file-contents "/dev/urandom" nil nil 10)
     (should (= (buffer-size) 10))))
 
+(ert-deftest fileio-tests--insert-file-contents-replace ()
+  "Test that REPLACE gives the same text as a fresh insertion."
+  (let ((f (make-temp-file "fileio"))
+        (head (concat "héllo ∀\n" (make-string 100 ?x) "\n")))
+    (unwind-protect
+        (dolist (test `((,(concat head "old\n" head) ,(concat head "new\n" head))
+                        (,(concat head "\200\n") ,(concat head "\u0080\n"))
+                        (,(concat "a\r\nb\r\n" head) ,(concat "a\r\nc\r\n" head))
+                        (,(concat head "€") "h\342\202")
+                        (,(concat head head) ,head)
+                        (,head ,(concat head (string #x110000)))))
+          (let ((coding-system-for-write 'utf-8-unix))
+            (write-region (cadr test) nil f nil 'silent))
+          (dolist (coding '(nil utf-8 utf-8-unix))
+            (let ((coding-system-for-read coding)
+                  (want (with-temp-buffer
+                          (let ((coding-system-for-read coding))
+                            (insert-file-contents f))
+                          (buffer-string))))
+              (with-temp-buffer
+                (insert (car test))
+                (let ((marker (copy-marker 3)))
+                  (insert-file-contents f nil nil nil t)
+                  (should (equal (buffer-string) want))
+                  (when (string-prefix-p head want)
+                    (should (= marker 3))))))))
+      (delete-file f))))
+
 (defun fileio-tests--identity-expand-handler (_ file &rest _)
   file)
 (put 'fileio-tests--identity-expand-handler 'operations '(expand-file-name))
@@ -1094,6 +1094,57 @@ test-bignum-hash
         (should (eq (gethash b2 hash)
                     (funcall test b1 b2)))))))
 
+;; Lookups in `eql' tables compare most keys by identity alone;
+;; check that floats and bignums still use `eql'.
+(ert-deftest test-eql-hash-mixed-keys ()
+  (let ((h (make-hash-table :test 'eql))
+        (keys (list 1 1.0 -0.0 0.0 0.0e+NaN 'a "a"
+                    (1+ most-positive-fixnum) (1- most-negative-fixnum))))
+    (dolist (k keys)
+      (puthash k k h))
+    (should (= (hash-table-count h) (length keys)))
+    (dolist (k keys)
+      (should (eq (gethash k h) k)))
+    (should (eql (gethash (read "1.0") h) 1.0))
+    (should (eql (gethash (- 0.0) h) -0.0))
+    (should (eql (gethash (1+ most-positive-fixnum) h)
+                 (1+ most-positive-fixnum)))
+    (should-not (gethash (copy-sequence "a") h))
+    (should-not (gethash 2.0 h))))
+
+(ert-deftest test-hash-table-reserve ()
+  (let ((h (make-hash-table :test 'eq :size 0)))
+    (should (eq (hash-table-reserve h 100) h))
+    (should (>= (hash-table-size h) 100))
+    (let ((size (hash-table-size h)))
+      (dotimes (i 100)
+        (puthash i (- i) h))
+      (should (= (hash-table-size h) size))
+      ;; Never shrink.
+      (hash-table-reserve h 10)
+      (should (= (hash-table-size h) size)))
+    ;; Reserving after removals keeps the remaining entries and reuses
+    ;; the freed ones.
+    (dotimes (i 50)
+      (remhash (* 2 i) h))
+    (hash-table-reserve h 1000)
+    (should (>= (hash-table-size h) 1000))
+    (should (= (hash-table-count h) 50))
+    (dotimes (i 100)
+      (should (eq (gethash i h 'none) (if (cl-oddp i) (- i) 'none))))
+    (dotimes (i 1000)
+      (puthash (+ i 100) i h))
+    (should (= (hash-table-count h) 1050))
+    (should (eq (gethash 1099 h) 999))
+    (should (eq (gethash 99 h) -99)))
+  (should-error (hash-table-reserve (make-hash-table) -1))
+  (should-error (hash-table-reserve (make-hash-table) most-positive-fixnum))
+  ;; Sizes that do not fit in the table's 32-bit indices.
+  (let ((h (make-hash-table)))
+    (should-error (hash-table-reserve h (ash 1 32)))
+    (should-error (hash-table-reserve h (+ 5 (ash 1 32))))
+    (should (< (hash-table-size h) 100))))
+
 (ert-deftest test-nthcdr-simple ()
   (should (eq (nthcdr 0 'x) 'x))
   (should (eq (nthcdr 1 '(x . y)) 'y))
@@ -1402,6 +1453,43 @@ test-line-number-at-position
     (should-error (line-number-at-pos -1))
     (should-error (line-number-at-pos 100))))
 
+(ert-deftest test-line-number-at-position-large-buffer ()
+  ;; Large enough for `line-number-at-pos' to use the line index, which
+  ;; must follow all kinds of changes to the text.
+  (with-temp-buffer
+    (dotimes (i 40000)
+      (insert (make-string (% i 61) (if (zerop (% i 5)) ?\u00e9 ?x)) "\n"))
+    (let ((check
+           (lambda ()
+             (dolist (pos (list (point-min) (min 1000 (point-max))
+                                (1+ (/ (buffer-size) 3))
+                                (1+ (/ (buffer-size) 2)) (point-max)))
+               (should (= (line-number-at-pos pos)
+                          (1+ (how-many "\n" (point-min) pos))))))))
+      (funcall check)
+      (goto-char (/ (point-max) 2))
+      (insert "a\nb\n\n")
+      (funcall check)
+      (delete-region 200000 700000)
+      (funcall check)
+      (goto-char (point-max))
+      (insert (make-string 300000 ?\n))
+      (funcall check)
+      (subst-char-in-region 1000 5000 ?x ?\n)
+      (funcall check)
+      (let ((indirect (make-indirect-buffer (current-buffer) " *indirect*")))
+        (unwind-protect
+            (with-current-buffer indirect
+              (goto-char 100)
+              (insert "\n\n")
+              (delete-region (- (point-max) 100000) (point-max)))
+          (kill-buffer indirect)))
+      (funcall check)
+      (set-buffer-multibyte nil)
+      (funcall check)
+      (erase-buffer)
+      (funcall check))))
+
 (defun fns-tests-concat (&rest args)
   ;; Dodge the byte-compiler's partial evaluation of `concat' with
   ;; constant arguments.
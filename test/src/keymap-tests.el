@@ -121,6 +121,55 @@ keymap-lookup-key/too-long
     (define-key map (kbd "C-c f") 'foo)
     (should (= (lookup-key map (kbd "C-c f x")) 2))))
 
+(ert-deftest keymap-lookup-key/after-changes ()
+  "Check that `lookup-key' sees changes made to a keymap it looked in."
+  (let ((map (make-sparse-keymap))
+        (parent (make-sparse-keymap))
+        (prefix (make-sparse-keymap))
+        (filtered nil))
+    (define-key map "a" 'foo)
+    (should (eq (lookup-key map "a") 'foo))
+    (define-key map "a" 'bar)
+    (should (eq (lookup-key map "a") 'bar))
+    (setcdr map (cons '(?a . baz) (cdr map)))
+    (should (eq (lookup-key map "a") 'baz))
+    (setcdr (assq ?a (cdr map)) 'qux)
+    (should (eq (lookup-key map "a") 'qux))
+    (define-key parent "b" 'foo)
+    (should-not (lookup-key map "b"))
+    (set-keymap-parent map parent)
+    (should (eq (lookup-key map "b") 'foo))
+    (define-key prefix "c" 'foo)
+    (fset 'keymap-tests--prefix prefix)
+    (define-key map "x" 'keymap-tests--prefix)
+    (should (eq (lookup-key map "xc") 'foo))
+    (fset 'keymap-tests--prefix (make-sparse-keymap))
+    (should-not (lookup-key map "xc"))
+    ;; Vectors and char-tables in a keymap.
+    (let* ((vec (make-vector 128 nil))
+           (full (make-keymap))
+           (vmap (list 'keymap vec))
+           (ctab (cadr full)))
+      (aset vec ?a 'one)
+      (should (eq (lookup-key vmap "a") 'one))
+      (aset vec ?a 'two)
+      (should (eq (lookup-key vmap "a") 'two))
+      (fillarray vec 'three)
+      (should (eq (lookup-key vmap "a") 'three))
+      (aset ctab ?a 'one)
+      (should (eq (lookup-key full "a") 'one))
+      (aset ctab ?a nil)
+      (should-not (lookup-key full "a"))
+      (let ((parent (make-char-table 'keymap)))
+        (aset parent ?a 'three)
+        (set-char-table-parent ctab parent)
+        (should (eq (lookup-key full "a") 'three))))
+    ;; Bindings computed by a menu item filter are not remembered.
+    (define-key map "f" `(menu-item "" foo :filter ,(lambda (_) filtered)))
+    (should-not (lookup-key map "f"))
+    (setq filtered 'bar)
+    (should (eq (lookup-key map "f") 'bar))))
+
 ;; TODO: Write test for the ACCEPT-DEFAULT argument.
 ;; (ert-deftest keymap-lookup-key/accept-default ()
 ;;   ...)
@@ -254,6 +303,63 @@ keymap-where-is-internal/menu-item
                    '([?x] [menu-bar foobar cmd1])))
     (should (equal (where-is-internal 'keymap-tests--command-1 map t) [?x]))))
 
+(ert-deftest keymap-where-is-internal/after-changes ()
+  "Check that `where-is-internal' sees changes made to the keymaps."
+  (let ((map (make-sparse-keymap))
+        (other (make-sparse-keymap)))
+    (define-key map "x" 'keymap-tests--command-1)
+    (define-key other "y" 'keymap-tests--command-1)
+    (should (equal (where-is-internal 'keymap-tests--command-1 map)
+                   '([?x])))
+    (should (equal (where-is-internal 'keymap-tests--command-1
+                                      (list map other))
+                   '([?x] [?y])))
+    (define-key map "z" 'keymap-tests--command-1)
+    (should (equal (where-is-internal 'keymap-tests--command-1 map)
+                   '([?z] [?x])))
+    (define-key map "x" 'keymap-tests--command-2)
+    (should (equal (where-is-internal 'keymap-tests--command-1 map)
+                   '([?z])))
+    (should (equal (where-is-internal 'keymap-tests--command-2 map)
+                   '([?x])))
+    ;; So are changes made without `define-key', also after repeated
+    ;; calls.
+    (dotimes (_ 3)
+      (should (equal (where-is-internal 'keymap-tests--command-2 map)
+                     '([?x]))))
+    (setcdr map (cons (cons ?w 'keymap-tests--command-2) (cdr map)))
+    (dotimes (_ 3)
+      (should (equal (where-is-internal 'keymap-tests--command-2 map)
+                     '([?w] [?x]))))
+    (let ((p1 (make-sparse-keymap))
+          (p2 (make-sparse-keymap)))
+      (define-key p1 "a" 'keymap-tests--command-1)
+      (define-key p2 "b" 'keymap-tests--command-1)
+      (fset 'keymap-tests--prefix p1)
+      (define-key map "p" 'keymap-tests--prefix)
+      (dotimes (_ 3)
+        (should (equal (where-is-internal 'keymap-tests--command-1 map)
+                       '([?z] [?p ?a]))))
+      (fset 'keymap-tests--prefix p2)
+      (dotimes (_ 3)
+        (should (equal (where-is-internal 'keymap-tests--command-1 map)
+                       '([?z] [?p ?b])))))
+    ;; And to vectors in keymaps.
+    (let* ((vec (make-vector 128 nil))
+           (vmap (list 'keymap vec)))
+      (aset vec ?a 'keymap-tests--command-1)
+      (dotimes (_ 3)
+        (should (equal (where-is-internal 'keymap-tests--command-1
+                                          (list vmap))
+                       '([?a]))))
+      (aset vec ?b 'keymap-tests--command-1)
+      (should (equal (where-is-internal 'keymap-tests--command-1 (list vmap))
+                     '([?a] [?b]))))
+    ;; Bindings that are lists are compared with `equal'.
+    (define-key map "l" (list 'lambda () '(interactive)))
+    (should (equal (where-is-internal (list 'lambda () '(interactive)) map)
+                   '([?l])))))
+
 
 (ert-deftest keymap-where-is-internal/advertised-binding ()
   ;; Make sure order does not matter.
@@ -416,6 +416,35 @@ test-try-completion-ignore-case
     (should (equal (try-completion "baz" '("bAz" "baz"))
                    (try-completion "baz" '("baz" "bAz"))))))
 
+(ert-deftest test-completion-flex-match ()
+  (should (equal (completion-flex-match "foo" '("fxoo" "éfxoo" "oof" ""))
+                 '(0.375 0.3 nil nil)))
+  (should (equal (completion-flex-match "foo" '("fxoo" "éfxoo") nil t)
+                 '((0.375 0 1 2 4) (0.3 1 2 3 5))))
+  (should (equal (completion-flex-match "FO" '("foo" "xFOo")) '(nil 0.5)))
+  (should (equal (completion-flex-match "FO" '("foo") t) '(0.6666666666666666)))
+  (should (equal (completion-flex-match "" '("abc" "")) '(0.0 1.0)))
+  ;; A unibyte non-ASCII pattern byte must not match inside the UTF-8
+  ;; sequence of an unrelated character.
+  (should (equal (completion-flex-match "\351" (list (string #x96c6)))
+                 '(nil)))
+  ;; The scores are those that the `flex' style used to compute with
+  ;; regexps.
+  (let ((candidates '("fabrobazo" "fbarbazoo" "barfoobaz" "foo" "fo"
+                      "FOO" "éfoo" "fééoo" "oof" "f-o-o-o")))
+    (dolist (ignore-case '(nil t))
+      (dolist (query '("foo" "fo" "o" "éo"))
+        (let ((completion-ignore-case ignore-case)
+              (re (completion-pcm--pattern->regex
+                   (completion-pcm--optimize-pattern
+                    (completion-flex--make-flex-pattern
+                     (list 'prefix query 'point)))
+                   'group)))
+          (should (equal (completion-flex-match query candidates ignore-case)
+                         (mapcar (lambda (str)
+                                   (completion--flex-score str re t))
+                                 candidates))))))))
+
 (ert-deftest test-inhibit-interaction ()
   (let ((inhibit-interaction t))
     (should-error (read-from-minibuffer "foo: ") :type 'inhibited-interaction)
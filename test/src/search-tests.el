@@ -79,4 +79,68 @@ search-test--replace-match-update-data
         ;;(should (equal (match-end 2) beg4))
         ))))
 
+;; `replace-match' overwrites text in place when the replacement is as
+;; long as the replaced text, without moving the gap.
+(ert-deftest search-test--replace-match-same-size ()
+  (with-temp-buffer
+    (buffer-enable-undo)
+    (insert "héllo wörld, hello world\n")
+    ;; Put the gap at the beginning of the buffer.
+    (goto-char (point-min))
+    (insert "x")
+    (undo-boundary)
+    (let ((inside (copy-marker 17))
+          (after (copy-marker 21))
+          (changes nil))
+      (add-hook 'after-change-functions
+                (lambda (beg end len) (push (list beg end len) changes))
+                nil t)
+      (goto-char 20)
+      (should (re-search-backward "hello" nil t))
+      (replace-match "HELLO")
+      (should (equal (buffer-string) "xhéllo wörld, HELLO world\n"))
+      (should (equal changes '((15 20 5))))
+      (should (= (point) 20))
+      (should (= inside 15))
+      (should (= after 21))
+      (goto-char (point-min))
+      (should (looking-at "xhéllo"))
+      (undo-boundary)
+      (undo)
+      (should (equal (buffer-string) "xhéllo wörld, hello world\n")))))
+
+;; Exercise the boundary cases of counting newlines in bulk, with the
+;; gap in the middle of the text and multibyte characters straddling
+;; the bulk chunks.
+(ert-deftest search-test--count-many-newlines ()
+  (with-temp-buffer
+    (dotimes (i 20000)
+      (insert (make-string (% i 97) (if (zerop (% i 3)) ?x ?\u00e9)) "\n"))
+    (goto-char (/ (point-max) 2))
+    (insert "gap")
+    (delete-char -3)
+    (dolist (n '(1 1023 1024 1025 9999 19999 20000))
+      (goto-char (point-min))
+      (should (= (forward-line n) 0))
+      (should (= (line-number-at-pos) (1+ n)))
+      (should (= (count-lines (point-min) (point)) n))
+      (should (bolp)))
+    (goto-char (point-min))
+    (should (= (forward-line 20001) 1))
+    (should (= (point) (point-max)))
+    (should (= (line-number-at-pos (point-max)) 20001))))
+
+(ert-deftest search-test--newline-counting-speed ()
+  :tags '(:expensive-test)
+  (with-temp-buffer
+    (dotimes (_ 1000000)
+      (insert "The quick brown fox jumps over the lazy dog.\n"))
+    (let ((start (float-time)))
+      (goto-char (point-min))
+      (should (= (forward-line 1000000) 0))
+      (should (= (line-number-at-pos) 1000001))
+      (should (= (count-lines (point-min) (point-max)) 1000000))
+      (message "Counted %d lines per second"
+               (/ 3000000 (max (- (float-time) start) 1e-6))))))
+
 ;;; search-tests.el ends here
@@ -479,6 +479,30 @@ treesit-query-api
                (treesit-pattern-expand "a\nb\rc\td\0e\"f\1g\\h\fi")
                "\"a\\nb\\rc\\td\\0e\\\"f\1g\\\\h\fi\"")))))
 
+(ert-deftest treesit-query-predicates ()
+  "Test the `:equal' and `:any-of' predicates."
+  (skip-unless (treesit-language-available-p 'json))
+  (with-temp-buffer
+    (insert "[1,2,\"2\",4,3,3]")
+    (let ((root-node (treesit-parser-root-node
+                      (treesit-parser-create 'json))))
+      (dolist (query '("((number) @n (#any-of @n \"2\" \"4\"))"
+                       (((number) @n (:any-of @n "2" "4")))))
+        (dolist (query (list query (treesit-query-compile 'json query)))
+          (dotimes (_ 2)
+            (should (equal '("2" "4")
+                           (mapcar #'treesit-node-text
+                                   (treesit-query-capture
+                                    root-node query nil nil t)))))))
+      (should (equal '("3" "3")
+                     (mapcar #'treesit-node-text
+                             (treesit-query-capture
+                              root-node
+                              '(((array (number) @a :anchor (number) @b
+                                        :anchor)
+                                 (:equal @a @b)))
+                              nil nil t)))))))
+
 ;;; Narrow
 
 (ert-deftest treesit-narrow ()